@@ -0,0 +1,143 @@
+#include "AllocTracker.h"
+
+#include <cstdlib>
+#include <new>
+
+void recordAllocation(size_t size);
+void recordDeallocation(size_t size);
+
+namespace {
+    // Every block carries its size in front so deallocations can be accounted
+    const size_t HEADER_SIZE = alignof(std::max_align_t);
+
+    thread_local AllocScope* innermostScope = nullptr;
+    thread_local long long liveBytes = 0;
+
+    void* allocate(size_t size) {
+        void* block = std::malloc(size + HEADER_SIZE);
+        if (!block) {
+            return nullptr;
+        }
+        *static_cast<size_t*>(block) = size;
+        recordAllocation(size);
+        return static_cast<char*>(block) + HEADER_SIZE;
+    }
+
+    void deallocate(void* ptr) {
+        if (!ptr) {
+            return;
+        }
+        void* block = static_cast<char*>(ptr) - HEADER_SIZE;
+        recordDeallocation(*static_cast<size_t*>(block));
+        std::free(block);
+    }
+
+    void* allocateOrThrow(size_t size) {
+        void* ptr;
+        while (!(ptr = allocate(size))) {
+            std::new_handler handler = std::get_new_handler();
+            if (!handler) {
+                throw std::bad_alloc();
+            }
+            handler();
+        }
+        return ptr;
+    }
+}
+
+void recordAllocation(size_t size) {
+    liveBytes += static_cast<long long>(size);
+    for (AllocScope* scope = innermostScope; scope; scope = scope->parent) {
+        ++scope->counters.allocations;
+        scope->counters.bytes += size;
+        if (liveBytes - scope->baseBytes > static_cast<long long>(scope->counters.peakBytes)) {
+            scope->counters.peakBytes = static_cast<size_t>(liveBytes - scope->baseBytes);
+        }
+    }
+}
+
+void recordDeallocation(size_t size) {
+    liveBytes -= static_cast<long long>(size);
+    for (AllocScope* scope = innermostScope; scope; scope = scope->parent) {
+        ++scope->counters.deallocations;
+    }
+}
+
+AllocScope::AllocScope(bool enabled) {
+    if (enabled) {
+        active = true;
+        parent = innermostScope;
+        baseBytes = liveBytes;
+        innermostScope = this;
+    }
+}
+
+AllocScope::~AllocScope() {
+    stop();
+}
+
+void AllocScope::stop() {
+    if (!active) {
+        return;
+    }
+    active = false;
+
+    // stop() may be called before an inner scope ends, unlink from the middle of the chain then
+    if (innermostScope == this) {
+        innermostScope = parent;
+        return;
+    }
+    for (AllocScope* scope = innermostScope; scope; scope = scope->parent) {
+        if (scope->parent == this) {
+            scope->parent = parent;
+            return;
+        }
+    }
+}
+
+AllocStats currentAllocStats() {
+    return innermostScope ? innermostScope->stats() : AllocStats();
+}
+
+
+// Replaced global allocation functions
+void* operator new(size_t size) {
+    return allocateOrThrow(size);
+}
+
+void* operator new[](size_t size) {
+    return allocateOrThrow(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    deallocate(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    deallocate(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    deallocate(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    deallocate(ptr);
+}
+
+// Sized variants are replaced even below C++14, code built with a newer standard may call them
+void operator delete(void* ptr, size_t) noexcept {
+    deallocate(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+    deallocate(ptr);
+}
@@ -0,0 +1,56 @@
+#ifndef ALLOC_TRACKER_H
+#define ALLOC_TRACKER_H
+
+#include <cstddef>
+#include <ostream>
+
+// Heap usage of the calling thread while an AllocScope is active
+struct AllocStats {
+    size_t allocations = 0;
+    size_t deallocations = 0;
+    size_t bytes = 0;     // total bytes requested
+    size_t peakBytes = 0; // peak live bytes above the level at the start of the scope
+
+    friend std::ostream& operator<<(std::ostream& os, const AllocStats& stats) {
+        return os << "allocations: " << stats.allocations
+                  << " bytes: " << stats.bytes
+                  << " peak: " << stats.peakBytes;
+    }
+};
+
+// Counts heap allocations of the calling thread from construction until stop() or destruction
+// The global operator new/delete are replaced in AllocTracker.cpp; scopes nest.
+class AllocScope {
+public:
+    explicit AllocScope(bool enabled = true);
+    ~AllocScope();
+
+    AllocScope(const AllocScope&) = delete;
+    AllocScope& operator=(const AllocScope&) = delete;
+
+    void stop();
+    const AllocStats& stats() const { return counters; }
+
+private:
+    friend void recordAllocation(size_t size);
+    friend void recordDeallocation(size_t size);
+
+    bool active = false;
+    AllocScope* parent = nullptr;
+    long long baseBytes = 0;
+    AllocStats counters;
+};
+
+// Stats of the innermost active scope of the calling thread (all zero if none)
+AllocStats currentAllocStats();
+
+// Heap usage of a single call
+template<typename F>
+AllocStats measureAllocations(F&& f) {
+    AllocScope scope;
+    f();
+    scope.stop();
+    return scope.stats();
+}
+
+#endif // ALLOC_TRACKER_H
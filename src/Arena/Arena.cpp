@@ -0,0 +1,48 @@
+#include "Arena.h"
+
+#include <algorithm>
+
+Arena::~Arena() {
+    reset();
+    for (Chunk& chunk : chunks) {
+        delete[] chunk.data;
+    }
+}
+
+void* Arena::allocate(size_t size, size_t align) {
+    while (current < chunks.size()) {
+        Chunk& chunk = chunks[current];
+        size_t start = (offset + align - 1) / align * align;
+        if (start + size <= chunk.size) {
+            offset = start + size;
+            used += size;
+            return chunk.data + start;
+        }
+        ++current;
+        offset = 0;
+    }
+
+    // no chunk left with enough room, chunk data is aligned for max_align_t by new[]
+    size_t newSize = std::max(chunkSize, size);
+    chunks.push_back({new char[newSize], newSize});
+    current = chunks.size() - 1;
+    offset = size;
+    used += size;
+    return chunks.back().data;
+}
+
+void Arena::reset() {
+    for (auto it = destructors.rbegin(); it != destructors.rend(); ++it) {
+        it->destroy(it->objects, it->count);
+    }
+    destructors.clear();
+    current = 0;
+    offset = 0;
+    used = 0;
+    ++resets;
+}
+
+Arena& caseArena() {
+    thread_local Arena arena;
+    return arena;
+}
@@ -0,0 +1,105 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Monotonic allocator for the values of a single test case
+// Objects are bump-allocated from chunks and released together by reset(),
+// which also keeps the chunks for the next case.
+class Arena {
+public:
+    explicit Arena(size_t chunkSize = 4096) : chunkSize(chunkSize) {}
+    ~Arena();
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    void* allocate(size_t size, size_t align = alignof(std::max_align_t));
+
+    template<typename T, typename... Args>
+    T* create(Args&&... args) {
+        T* object = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        registerDestructor<T>(object, 1);
+        return object;
+    }
+
+    // Default-constructed array of n elements
+    template<typename T>
+    T* createArray(size_t n) {
+        if (n == 0) {
+            return nullptr;
+        }
+        T* objects = static_cast<T*>(allocate(sizeof(T) * n, alignof(T)));
+        for (size_t i = 0; i < n; ++i) {
+            new (objects + i) T();
+        }
+        registerDestructor<T>(objects, n);
+        return objects;
+    }
+
+    // Destroys all objects and rewinds to the first chunk
+    void reset();
+
+    size_t bytesUsed() const { return used; }
+
+    // Number of resets so far, tells whether pointers into the arena are still valid
+    size_t generation() const { return resets; }
+
+private:
+    struct Chunk {
+        char* data;
+        size_t size;
+    };
+
+    struct Destructor {
+        void (*destroy)(void*, size_t);
+        void* objects;
+        size_t count;
+    };
+
+    template<typename T>
+    static void destroy(void* objects, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            static_cast<T*>(objects)[i].~T();
+        }
+    }
+
+    template<typename T>
+    void registerDestructor(T* objects, size_t count) {
+        if (!std::is_trivially_destructible<T>::value) {
+            destructors.push_back({&Arena::destroy<T>, objects, count});
+        }
+    }
+
+    size_t chunkSize;
+    std::vector<Chunk> chunks;
+    size_t current = 0; // index of the chunk in use
+    size_t offset = 0;  // first free byte in the current chunk
+    size_t used = 0;
+    size_t resets = 0;
+    std::vector<Destructor> destructors;
+};
+
+// Arena of the calling thread, reset by the runners at the start of every case
+Arena& caseArena();
+
+// Resets an arena (by default the case arena) when it ends
+// Generators that keep values in the case arena (tree, TreeGen, recursive) grow it with every value;
+// code calling them outside a runner resets it with a scope per value or batch of values.
+class ArenaScope {
+public:
+    explicit ArenaScope(Arena& arena = caseArena()) : arena(arena) {}
+    ~ArenaScope() { arena.reset(); }
+
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+
+private:
+    Arena& arena;
+};
+
+#endif // ARENA_H
@@ -0,0 +1,21 @@
+#include "Check.h"
+
+#include <limits>
+#include <sstream>
+
+std::ostream& operator<<(std::ostream& os, const CaseId& id) {
+    // shortest representation that reads back as the same ratio
+    std::string ratio;
+    for (int precision = 1; precision <= std::numeric_limits<double>::max_digits10; ++precision) {
+        std::ostringstream out;
+        out.precision(precision);
+        out << id.edgeCaseRatio;
+        ratio = out.str();
+        if (std::stod(ratio) == id.edgeCaseRatio) {
+            break;
+        }
+    }
+
+    return os << "seed=" << id.seed << " property=" << id.propertyId << " case=" << id.index
+              << " edgeCaseRatio=" << ratio;
+}
@@ -0,0 +1,226 @@
+#ifndef CHECK_H
+#define CHECK_H
+
+#include "Random/Random.h"
+#include "Alloc/AllocTracker.h"
+#include "Arena/Arena.h"
+#include "Mutate/Mutate.h"
+#include "Corpus/Corpus.h"
+
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <ostream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Identifies a single test case; fully reproduces its input
+// The edge case ratio is part of the id, it decides which draws become edge cases.
+struct CaseId {
+    uint64_t seed;
+    uint32_t propertyId;
+    uint64_t index;
+    double edgeCaseRatio;
+
+    CaseId(const uint64_t seed, const uint32_t propertyId, const uint64_t index,
+           const double edgeCaseRatio = DEFAULT_EDGE_CASE_RATIO) :
+            seed(seed), propertyId(propertyId), index(index), edgeCaseRatio(edgeCaseRatio) {}
+};
+
+// Prints the id as "seed=S property=P case=I edgeCaseRatio=R", the ratio with as many digits as it needs
+std::ostream& operator<<(std::ostream& os, const CaseId& id);
+
+// Runner configuration shared by quickCheck and quickCheckOO
+struct CheckConfig {
+    size_t numCases = 20;
+    uint64_t seed;
+    uint32_t propertyId = 0;
+    uint64_t firstCase = 0;
+    double edgeCaseRatio = DEFAULT_EDGE_CASE_RATIO;
+    bool trackAllocations = false; // count heap usage of each property call and report it
+    bool shrink = true;            // shrink failing values if the generator supports it
+    size_t maxShrinkSteps = 1000;
+    double mutationRatio = 0.0;    // share of cases derived from earlier inputs by mutation, see MutationPool
+    size_t mutationPoolSize = 32;
+    std::string corpusFile;        // if set, every input is appended to this file (see Corpus.h)
+
+    explicit CheckConfig(const size_t numCases = 20) : numCases(numCases), seed(randomSeed()) {}
+
+    // Runs exactly the case identified by `id`
+    static CheckConfig reproduce(const CaseId& id) {
+        CheckConfig config(1);
+        config.seed = id.seed;
+        config.propertyId = id.propertyId;
+        config.firstCase = id.index;
+        config.edgeCaseRatio = id.edgeCaseRatio;
+        return config;
+    }
+
+    // Positions the thread's random stream at case `index` and returns its id
+    // and releases the values of the previous case from the case arena
+    CaseId beginCase(const uint64_t index) const {
+        caseArena().reset();
+        setEdgeCaseRatio(edgeCaseRatio);
+        seedCase(seed, propertyId, index);
+        return {seed, propertyId, index, edgeCaseRatio};
+    }
+};
+
+// Compile-time index list for unpacking tuples
+template<size_t... Is>
+struct IndexSequence {};
+
+template<size_t N, size_t... Is>
+struct MakeIndexSequence : MakeIndexSequence<N - 1, N - 1, Is...> {};
+
+template<size_t... Is>
+struct MakeIndexSequence<0, Is...> {
+    typedef IndexSequence<Is...> type;
+};
+
+
+// Value printing used by the case report
+template<typename T>
+void printValue(std::ostream& os, const T& value) {
+    os << value;
+}
+
+template<typename T>
+void printValue(std::ostream& os, const std::vector<T>& values) {
+    os << "[";
+    for (size_t i = 0; i < values.size(); ++i) {
+        os << (i > 0 ? ", " : "");
+        printValue(os, values[i]);
+    }
+    os << "]";
+}
+
+template<typename... Ts, size_t... Is>
+void printTuple(std::ostream& os, const std::tuple<Ts...>& values, IndexSequence<Is...>) {
+    int expand[] = {0, (os << (Is > 0 ? ", " : ""), printValue(os, std::get<Is>(values)), 0)...};
+    (void) expand;
+}
+
+template<typename... Ts>
+void printValue(std::ostream& os, const std::tuple<Ts...>& values) {
+    os << "(";
+    printTuple(os, values, typename MakeIndexSequence<sizeof...(Ts)>::type());
+    os << ")";
+}
+
+
+// Calls the property with the generated value by reference; tuples are unpacked
+// into multiple arguments unless the property takes the tuple itself
+template<typename P, typename T>
+auto applyProperty(P& p, T& value, int) -> decltype(static_cast<bool>(p(value))) {
+    return p(value);
+}
+
+template<typename P, typename... Ts, size_t... Is>
+bool applyTuple(P& p, std::tuple<Ts...>& values, IndexSequence<Is...>) {
+    return p(std::get<Is>(values)...);
+}
+
+template<typename P, typename... Ts>
+bool applyProperty(P& p, std::tuple<Ts...>& values, long) {
+    return applyTuple(p, values, typename MakeIndexSequence<sizeof...(Ts)>::type());
+}
+
+// True if P is exactly a function (pointer) property of T; those use the non-generic runner overloads
+// Captureless lambdas convert to such a pointer but are not one, they take the generic overloads.
+template<typename P, typename T>
+struct IsPropertyPointer : std::is_same<typename std::decay<P>::type, bool (*)(T)> {};
+
+
+// Prints the result line of a case
+template<typename T>
+void reportCase(const CheckConfig& config, const CaseId& id, const T& value, const bool passed,
+                const bool mutated, const AllocStats& allocations) {
+    if (passed) {
+        std::cout << "[       OK ] value: ";
+        printValue(std::cout, value);
+    } else if (!mutated) {
+        std::cout << "[   Failed ] value: ";
+        printValue(std::cout, value);
+        std::cout << " (" << id << ")";
+    } else {
+        // a mutated case depends on the pool built by the cases before it, CheckConfig::reproduce cannot rebuild it
+        std::cout << "[   Failed ] value: ";
+        printValue(std::cout, value);
+        std::cout << " (" << id << ", derived by mutation: replay with firstCase=" << config.firstCase
+                  << " numCases=" << id.index - config.firstCase + 1 << " and the same mutation settings)";
+    }
+    if (config.trackAllocations) {
+        std::cout << " [" << allocations << "]";
+    }
+    std::cout << std::endl;
+}
+
+// Greedily replaces a failing value by smaller failing candidates, returns the number of steps taken
+template<typename T, typename S, typename P>
+size_t shrinkFailure(const CheckConfig& config, S& shrink, P& p, T& value) {
+    size_t steps = 0;
+    bool shrunk = true;
+
+    while (shrunk && steps < config.maxShrinkSteps) {
+        shrunk = false;
+        for (auto&& candidate : shrink(value)) {
+            if (!applyProperty(p, candidate, 0)) {
+                value = candidate;
+                ++steps;
+                shrunk = true;
+                break;
+            }
+        }
+    }
+
+    return steps;
+}
+
+// Runs the property on config.numCases generated values, returns true if all of them passed
+// `shrink` returns smaller candidates for a failing value, `mutate` (optional) changes a value
+// within the generator's domain for the mutation mode.
+// In mutation mode a mutated case depends on the earlier ones, it reproduces only
+// when the run is replayed from config.firstCase; fresh cases reproduce from their id.
+template<typename T, typename G, typename S, typename P>
+bool runProperty(const CheckConfig& config, G&& generate, S&& shrink, std::function<void(T&)> mutate, P&& p) {
+    bool passed = true;
+    EdgeCaseRatioScope edgeCases(config.edgeCaseRatio); // beginCase sets it per case, restored after the run
+    MutationPool<T> pool(config.mutationPoolSize, config.mutationRatio, std::move(mutate));
+    CorpusWriter<T> corpus(config.corpusFile);
+
+    for (uint64_t i = config.firstCase; i < config.firstCase + config.numCases; ++i) {
+        CaseId id = config.beginCase(i);
+        bool mutated = pool.pickMutation(id.seed, id.propertyId, id.index);
+        T value = mutated ? pool.takeMutated() : generate();
+
+        AllocScope allocations(config.trackAllocations);
+        bool result = applyProperty(p, value, 0);
+        allocations.stop();
+
+        reportCase(config, id, value, result, mutated, allocations.stats());
+        passed = passed && result;
+        corpus.save(value);
+
+        // shrinks a copy: the pool keeps the input the case drew, so later mutated cases do not depend on shrinking
+        if (!result && config.shrink) {
+            T shrunk = value;
+            size_t steps = shrinkFailure(config, shrink, p, shrunk);
+            if (steps > 0) {
+                std::cout << "[   Shrunk ] value: ";
+                printValue(std::cout, shrunk);
+                std::cout << " (" << steps << " steps)" << std::endl;
+            }
+        }
+
+        pool.keep(std::move(value));
+    }
+
+    return passed;
+}
+
+#endif // CHECK_H
@@ -0,0 +1,169 @@
+#include "Corpus.h"
+
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+
+namespace {
+    std::string escape(const std::string& str) {
+        std::string result;
+        result.reserve(str.size());
+        for (char c : str) {
+            switch (c) {
+                case '\\':
+                    result += "\\\\";
+                    break;
+                case '\t':
+                    result += "\\t";
+                    break;
+                case '\n':
+                    result += "\\n";
+                    break;
+                case '\r':
+                    result += "\\r";
+                    break;
+                default:
+                    result += c;
+            }
+        }
+        return result;
+    }
+
+    bool unescape(const std::string& field, std::string& str) {
+        str.clear();
+        for (size_t i = 0; i < field.size(); ++i) {
+            if (field[i] != '\\') {
+                str += field[i];
+                continue;
+            }
+            if (++i == field.size()) {
+                return false;
+            }
+            switch (field[i]) {
+                case '\\':
+                    str += '\\';
+                    break;
+                case 't':
+                    str += '\t';
+                    break;
+                case 'n':
+                    str += '\n';
+                    break;
+                case 'r':
+                    str += '\r';
+                    break;
+                default:
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    std::vector<std::string> split(const std::string& line) {
+        std::vector<std::string> fields;
+        size_t start = 0;
+        size_t pos;
+        while ((pos = line.find('\t', start)) != std::string::npos) {
+            fields.push_back(line.substr(start, pos - start));
+            start = pos + 1;
+        }
+        fields.push_back(line.substr(start));
+        return fields;
+    }
+
+    bool parseLong(const std::string& field, long long& value) {
+        if (field.empty()) {
+            return false;
+        }
+        char* end;
+        errno = 0;
+        value = std::strtoll(field.c_str(), &end, 10);
+        return errno == 0 && *end == '\0';
+    }
+}
+
+std::string encode(const int value) {
+    return std::to_string(value);
+}
+
+std::string encode(const unsigned int value) {
+    return std::to_string(value);
+}
+
+std::string encode(const std::string& str) {
+    return escape(str);
+}
+
+// "0" is the empty list, "1\t" a list of one empty string
+std::string encode(const std::vector<std::string>& values) {
+    std::string line = std::to_string(values.size());
+    for (const std::string& str : values) {
+        line += '\t';
+        line += escape(str);
+    }
+    return line;
+}
+
+std::string encode(const Person& person) {
+    return escape(person.firstName) + '\t' + escape(person.lastName) + '\t' +
+           std::to_string(person.age) + '\t' + std::to_string(static_cast<int>(person.role));
+}
+
+bool decode(const std::string& line, int& value) {
+    long long parsed;
+    if (!parseLong(line, parsed) || parsed < INT_MIN || parsed > INT_MAX) {
+        return false;
+    }
+    value = static_cast<int>(parsed);
+    return true;
+}
+
+bool decode(const std::string& line, unsigned int& value) {
+    long long parsed;
+    if (!parseLong(line, parsed) || parsed < 0 || parsed > UINT_MAX) {
+        return false;
+    }
+    value = static_cast<unsigned int>(parsed);
+    return true;
+}
+
+bool decode(const std::string& line, std::string& str) {
+    return unescape(line, str);
+}
+
+bool decode(const std::string& line, std::vector<std::string>& values) {
+    std::vector<std::string> fields = split(line);
+    long long count;
+    if (!parseLong(fields[0], count) || count < 0 || static_cast<size_t>(count) != fields.size() - 1) {
+        return false;
+    }
+    values.resize(fields.size() - 1);
+    for (size_t i = 1; i < fields.size(); ++i) {
+        if (!unescape(fields[i], values[i - 1])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool decode(const std::string& line, Person& person) {
+    std::vector<std::string> fields = split(line);
+    long long age;
+    long long role;
+    if (fields.size() != 4 || !parseLong(fields[2], age) || !parseLong(fields[3], role) ||
+        age < INT_MIN || age > INT_MAX || (role != STUDENT && role != TEACHER)) {
+        return false;
+    }
+    person.age = static_cast<int>(age);
+    person.role = static_cast<Role>(role);
+    return unescape(fields[0], person.firstName) && unescape(fields[1], person.lastName);
+}
+
+uint64_t contentHash(const std::string& line) {
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : line) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
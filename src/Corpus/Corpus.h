@@ -0,0 +1,76 @@
+#ifndef CORPUS_H
+#define CORPUS_H
+
+#include "Person.h"
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Line-based corpus format, one input per line
+// Fields are separated by tabs; backslashes, tabs and line breaks inside strings are escaped.
+std::string encode(int value);
+std::string encode(unsigned int value);
+std::string encode(const std::string& str);
+std::string encode(const std::vector<std::string>& values); // count, then the elements
+std::string encode(const Person& person);                   // firstName, lastName, age, role
+
+// Returns false for malformed lines
+bool decode(const std::string& line, int& value);
+bool decode(const std::string& line, unsigned int& value);
+bool decode(const std::string& line, std::string& str);
+bool decode(const std::string& line, std::vector<std::string>& values);
+bool decode(const std::string& line, Person& person);
+
+// Content hash of an encoded input (FNV-1a)
+uint64_t contentHash(const std::string& line);
+
+// True if there are encode/decode overloads for T
+template<typename T>
+struct IsEncodable {
+    template<typename U>
+    static auto test(int) -> decltype(encode(std::declval<const U&>()),
+                                      decode(std::declval<const std::string&>(), std::declval<U&>()),
+                                      std::true_type());
+
+    template<typename U>
+    static std::false_type test(...);
+
+    static const bool value = decltype(test<T>(0))::value;
+};
+
+template<typename T>
+auto encodeValue(const T& value, int) -> decltype(encode(value)) {
+    return encode(value);
+}
+
+template<typename T>
+std::string encodeValue(const T&, long) {
+    return std::string();
+}
+
+
+// Appends the inputs of a run to a corpus file, does nothing without a path or for types it cannot encode
+template<typename T>
+class CorpusWriter {
+private:
+    std::ofstream file;
+
+public:
+    explicit CorpusWriter(const std::string& path) {
+        if (IsEncodable<T>::value && !path.empty()) {
+            file.open(path, std::ios::app);
+        }
+    }
+
+    void save(const T& value) {
+        if (file.is_open()) {
+            file << encodeValue(value, 0) << '\n';
+        }
+    }
+};
+
+#endif // CORPUS_H
@@ -0,0 +1,128 @@
+#ifndef MINIMIZE_H
+#define MINIMIZE_H
+
+#include "Corpus/Corpus.h"
+#include "Alloc/AllocTracker.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <set>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <unordered_set>
+#include <vector>
+
+// Observed behavior of a property on one input:
+// its outcome and the heap usage of the call as a cheap coverage signal
+struct Signature {
+    bool passed = false;
+    size_t allocations = 0;
+    unsigned int peakClass = 0; // bit length of the peak bytes
+
+    bool operator<(const Signature& other) const {
+        return std::tie(passed, allocations, peakClass) <
+               std::tie(other.passed, other.allocations, other.peakClass);
+    }
+};
+
+template<typename T, typename P>
+Signature observe(P& p, T& value) {
+    AllocScope allocations;
+    bool passed = p(value);
+    allocations.stop();
+
+    Signature signature;
+    signature.passed = passed;
+    signature.allocations = allocations.stats().allocations;
+    for (size_t peak = allocations.stats().peakBytes; peak > 0; peak >>= 1) {
+        ++signature.peakClass;
+    }
+    return signature;
+}
+
+struct CorpusStats {
+    size_t read = 0;
+    size_t malformed = 0;
+    size_t duplicates = 0; // same content as an earlier input
+    size_t redundant = 0;  // same signature as an earlier input
+    size_t kept = 0;
+};
+
+// Streams a corpus of encoded T inputs from `in` to `out`, keeping only the first input
+// of every distinct content and signature. Inputs are read in batches, the property
+// runs on each batch in parallel with one copy of `p` per worker; the output keeps input order.
+template<typename T, typename P>
+CorpusStats minimizeCorpus(std::istream& in, std::ostream& out, P p,
+                           size_t numThreads = std::thread::hardware_concurrency(), const size_t batchSize = 1024) {
+    struct Entry {
+        std::string line;
+        bool valid = false;
+        Signature signature;
+    };
+
+    numThreads = std::max<size_t>(numThreads, 1);
+    CorpusStats stats;
+    std::unordered_set<uint64_t> seenContent;
+    std::set<Signature> seenSignatures;
+    std::vector<Entry> batch;
+    batch.reserve(batchSize);
+
+    auto flush = [&]() {
+        if (batch.empty()) {
+            return;
+        }
+
+        std::vector<std::thread> workers;
+        for (size_t t = 0; t < numThreads; ++t) {
+            workers.emplace_back([&batch, &p, t, numThreads]() {
+                P property = p;
+                T value;
+                for (size_t i = t; i < batch.size(); i += numThreads) {
+                    batch[i].valid = decode(batch[i].line, value);
+                    if (batch[i].valid) {
+                        batch[i].signature = observe(property, value);
+                    }
+                }
+            });
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+
+        for (const Entry& entry : batch) {
+            if (!entry.valid) {
+                ++stats.malformed;
+            } else if (!seenSignatures.insert(entry.signature).second) {
+                ++stats.redundant;
+            } else {
+                out << entry.line << '\n';
+                ++stats.kept;
+            }
+        }
+        batch.clear();
+    };
+
+    std::string line;
+    while (std::getline(in, line)) {
+        ++stats.read;
+        if (!seenContent.insert(contentHash(line)).second) {
+            ++stats.duplicates;
+            continue;
+        }
+
+        batch.push_back(Entry());
+        batch.back().line = std::move(line);
+        if (batch.size() == batchSize) {
+            flush();
+        }
+    }
+    flush();
+
+    return stats;
+}
+
+#endif // MINIMIZE_H
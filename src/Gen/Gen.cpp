@@ -1 +1,234 @@
 #include "Gen.h"
+
+template class Gen<int>;
+template class Gen<unsigned int>;
+template class Gen<char>;
+template class Gen<std::string>;
+template class Gen<bool>;
+template class Gen<std::vector<int>>;
+template class Gen<std::vector<std::string>>;
+template class Gen<Role>;
+template class Gen<Person>;
+
+template Gen<int> elements<int>(std::vector<int>);
+template Gen<char> elements<char>(std::vector<char>);
+template Gen<std::string> elements<std::string>(std::vector<std::string>);
+template Gen<int> withEdgeCases<int>(Gen<int>, std::vector<int>);
+template Gen<unsigned int> withEdgeCases<unsigned int>(Gen<unsigned int>, std::vector<unsigned int>);
+template Gen<char> withEdgeCases<char>(Gen<char>, std::vector<char>);
+
+
+// Integer generator
+template<>
+Gen<int> arbitrary<int>() {
+    Gen<int> uniform = {[]() {
+        std::uniform_int_distribution<int> dis(-100, 100);
+        return dis(rng());
+    }, {}, [](int& value) {
+        mutateInt(value, -100, 100);
+    }};
+    return withEdgeCases(uniform, {0, 1, -1, std::numeric_limits<int>::min(), std::numeric_limits<int>::max()});
+}
+
+template<>
+Gen<unsigned int> arbitrary<unsigned int>() {
+    Gen<unsigned int> uniform = {[]() {
+        std::uniform_int_distribution<unsigned int> dis(0, 100);
+        return dis(rng());
+    }, {}, [](unsigned int& value) {
+        mutateUnsigned(value, 0, 100);
+    }};
+    return withEdgeCases(uniform, {0u, 1u, std::numeric_limits<unsigned int>::max()});
+}
+
+template<>
+Gen<char> arbitrary<char>() {
+    Gen<char> uniform = {[]() {
+        std::uniform_int_distribution<char> dis('a', 'z');
+        return dis(rng());
+    }, {}, [](char& c) {
+        int value = c;
+        mutateInt(value, 'a', 'z');
+        c = static_cast<char>(value);
+    }};
+    return withEdgeCases(uniform, {'a', 'z', ' '});
+}
+
+// String generator
+template<>
+Gen<std::string> arbitrary<std::string>() {
+    Gen<char> character = arbitrary<char>(); // built once, not per char
+
+    return {[character]() mutable {
+        std::uniform_int_distribution<size_t> len_dis(1, 40);
+        std::uniform_int_distribution<size_t> space_dis(0, 10);
+
+        size_t length = len_dis(rng());
+
+        // edge cases: empty, all spaces, max length
+        if (pickEdgeCase()) {
+            std::uniform_int_distribution<int> kind_dis(0, 2);
+            switch (kind_dis(rng())) {
+                case 0:
+                    return std::string();
+                case 1:
+                    return std::string(length, ' ');
+                default:
+                    length = len_dis.max();
+            }
+        }
+
+        size_t numSpaces = 0;
+        size_t numChars = 0;
+
+        if(length > 0) {
+            numSpaces = space_dis(rng());
+            numSpaces = numSpaces >= length ? length - 1: numSpaces;
+            numChars = length - numSpaces;
+        }
+
+        std::string str;
+        str.reserve(length);
+
+        // generate chars and append them
+        for (size_t i = 0; i < numChars; ++i) {
+            str.append(1, character.generate());
+        }
+
+        // append spaces
+        str.append(numSpaces, ' ');
+
+        // shuffle the string to distribute spaces and characters more randomly
+        std::shuffle(str.begin(), str.end(), rng());
+
+        // replace spaces > 5
+        size_t pos = 0;
+        while ((pos = str.find("      ", pos)) != std::string::npos) {
+            str.replace(pos, 6, "     "); // replace
+            pos += 5;
+        }
+
+        return str;
+    }, {}, [](std::string& str) {
+        mutateString(str, 0, 40, 'a', 'z');
+    }};
+}
+
+// bool generator
+template<>
+Gen<bool> arbitrary<bool>() {
+    return {[]() {
+        std::uniform_int_distribution<int> dis(0, 1);
+        return static_cast<bool>(dis(rng()));
+    }, {}, [](bool& value) {
+        value = !value;
+    }};
+}
+
+// int list generator
+template<>
+Gen<std::vector<int>> arbitrary<std::vector<int>>() {
+    Gen<int> element = arbitrary<int>();
+    Gen<int> edgeLengths = elements<int>({0, 1, 10}); // edge cases: empty, single, max length
+
+    return {[element, edgeLengths]() mutable {
+        std::vector<int> result;
+        std::uniform_int_distribution<int> lenDist(0, 10); // length
+
+        int length = lenDist(rng());
+        if (pickEdgeCase()) {
+            length = edgeLengths.generate();
+        }
+        result.reserve(length); // reserve
+
+        for (int i = 0; i < length; ++i) {
+            result.push_back(element.generate());
+        }
+
+        return result;
+    }, {}, [element](std::vector<int>& values) mutable {
+        mutateVector(values, 10, element.mutate, element.gen);
+    }};
+}
+
+// string list generator
+template<>
+Gen<std::vector<std::string>> arbitrary<std::vector<std::string>>() {
+    Gen<std::string> element = arbitrary<std::string>();
+    Gen<int> edgeLengths = elements<int>({0, 1, 10}); // edge cases: empty, single, max length
+
+    return {[element, edgeLengths]() mutable {
+        std::vector<std::string> result;
+        std::uniform_int_distribution<int> lenDist(0, 10); // length
+
+        int length = lenDist(rng());
+        if (pickEdgeCase()) {
+            length = edgeLengths.generate();
+        }
+        result.reserve(length); // reserve
+
+        for (int i = 0; i < length; ++i) {
+            result.push_back(element.generate());
+        }
+
+        return result;
+    }, {}, [element](std::vector<std::string>& values) mutable {
+        mutateVector(values, 10, element.mutate, element.gen);
+    }};
+}
+
+
+// Person generator
+template<>
+Gen<Role> arbitrary<Role>() {
+    return {[]() {
+        Role role;
+        std::uniform_int_distribution<int> dis(0, 1);
+        role = static_cast<Role>(dis(rng()));
+        return role;
+    }, {}, [](Role& role) {
+        role = role == STUDENT ? TEACHER : STUDENT;
+    }};
+}
+
+template<>
+Gen<Person> arbitrary<Person>() {
+    // non-negative age with its own edge cases, arbitrary<unsigned int> would overflow int
+    Gen<int> uniformAge = {[]() {
+        std::uniform_int_distribution<int> dis(0, 100);
+        return dis(rng());
+    }, {}, [](int& value) {
+        mutateInt(value, 0, 100);
+    }};
+    Gen<int> age = withEdgeCases(uniformAge, {0, 100});
+    Gen<std::string> name = arbitrary<std::string>();
+    Gen<Role> role = arbitrary<Role>();
+
+    return {[age, name, role]() mutable {
+        Person person;
+        person.firstName = name.generate();
+        person.lastName = name.generate();
+        person.age = age.generate();
+        person.role = role.generate();
+        return person;
+    }, {}, [age, name, role](Person& person) mutable {
+        // one field changed within its own domain, or the names swapped
+        std::uniform_int_distribution<int> op_dis(0, 4);
+        switch (op_dis(rng())) {
+            case 0:
+                std::swap(person.firstName, person.lastName);
+                break;
+            case 1:
+                name.mutate(person.firstName);
+                break;
+            case 2:
+                name.mutate(person.lastName);
+                break;
+            case 3:
+                age.mutate(person.age);
+                break;
+            default:
+                role.mutate(person.role);
+        }
+    }};
+}
@@ -2,12 +2,22 @@
 #define GEN_H
 
 #include "Person.h"
+#include "Check/Check.h"
+#include "Random/Random.h"
+#include "Arena/Arena.h"
+#include "Tree/Tree.h"
 
 #include <functional>
 #include <iostream>
 #include <random>
 #include <string>
 #include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 // Gen class definition
 template<typename T>
@@ -15,182 +25,423 @@ class Gen {
 public:
     Gen() = default;
     Gen(std::function<T()> gen_) { gen = std::function<T()>(gen_); }
+    Gen(std::function<T()> gen_, std::function<std::vector<T>(const T&)> shrink_) :
+            gen(std::move(gen_)), shrink(std::move(shrink_)) {}
+    Gen(std::function<T()> gen_, std::function<std::vector<T>(const T&)> shrink_, std::function<void(T&)> mutate_) :
+            gen(std::move(gen_)), shrink(std::move(shrink_)), mutate(std::move(mutate_)) {}
 
     std::function<T()> gen;
+    std::function<std::vector<T>(const T&)> shrink; // optional, smaller candidates for a failing value
+    std::function<void(T&)> mutate;                 // optional, changes a value in place within the domain of gen
     T generate() { return gen(); };
+
+    std::vector<T> shrinkValue(const T& value) {
+        return shrink ? shrink(value) : std::vector<T>();
+    }
 };
 
 template<typename T>
 Gen<T> arbitrary();
 
 
-// Integer generator
-template<>
-Gen<int> arbitrary<int>() {
-    return {[]() {
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
-        static std::uniform_int_distribution<int> dis(-100, 100);
-        return dis(gen);
+// Picks one of the values uniformly
+template<typename T>
+Gen<T> elements(std::vector<T> values) {
+    if (values.empty()) {
+        throw std::invalid_argument("elements: no values to pick from");
+    }
+    return {[values]() {
+        std::uniform_int_distribution<size_t> dis(0, values.size() - 1);
+        return values[dis(rng())];
     }};
 }
 
-template<>
-Gen<unsigned int> arbitrary<unsigned int>() {
-    return {[]() {
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
-        static std::uniform_int_distribution<unsigned int> dis(0, 100);
-        return dis(gen);
+// Picks one of the generators with a probability proportional to its weight
+template<typename T>
+Gen<T> frequency(std::vector<std::pair<unsigned int, Gen<T>>> gens) {
+    unsigned int total = 0;
+    for (const auto& g : gens) {
+        total += g.first;
+    }
+    if (total == 0) {
+        throw std::invalid_argument("frequency: weights sum to zero");
+    }
+
+    return {[gens, total]() mutable {
+        std::uniform_int_distribution<unsigned int> dis(0, total - 1);
+        unsigned int pick = dis(rng());
+        for (auto& g : gens) {
+            if (pick < g.first) {
+                return g.second.generate();
+            }
+            pick -= g.first;
+        }
+        return gens.back().second.generate();
     }};
 }
 
-template<>
-Gen<char> arbitrary<char>() {
-    return {[]() {
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
-        static std::uniform_int_distribution<char> dis('a', 'z');
-        return dis(gen);
-    }};
+// Returns one of the edge cases with the configured edge case ratio, otherwise draws from g
+// Mutations of g are replaced by an edge case with the same ratio.
+template<typename T>
+Gen<T> withEdgeCases(Gen<T> g, std::vector<T> edgeCases) {
+    Gen<T> edges = elements(std::move(edgeCases));
+    std::function<void(T&)> mutate;
+    if (g.mutate) {
+        mutate = [g, edges](T& value) mutable {
+            if (pickEdgeCase()) {
+                value = edges.generate();
+            } else {
+                g.mutate(value);
+            }
+        };
+    }
+
+    return {[g, edges]() mutable {
+                return pickEdgeCase() ? edges.generate() : g.generate();
+            },
+            g.shrink,
+            mutate};
 }
 
-// String generator
+
+// Built-in generators, compiled once in Gen.cpp
+
+// Integer generators
 template<>
-Gen<std::string> arbitrary<std::string>() {
-    return {[]() {
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
-        static std::uniform_int_distribution<size_t> len_dis(1, 40);
-        static std::uniform_int_distribution<size_t> space_dis(0, 10);
-
-        size_t length = len_dis(gen);
-        size_t numSpaces = 0;
-        size_t numChars = 0;
-
-        if(length > 0) {
-            numSpaces = space_dis(gen);
-            numSpaces = numSpaces >= length ? length - 1: numSpaces;
-            numChars = length - numSpaces;
-        }
+Gen<int> arbitrary<int>();
 
-        std::string str;
-        str.reserve(length);
+template<>
+Gen<unsigned int> arbitrary<unsigned int>();
 
-        // generate chars and append them
-        for (size_t i = 0; i < numChars; ++i) {
-            str.append(1, arbitrary<char>().generate());
-        }
+template<>
+Gen<char> arbitrary<char>();
 
-        // append spaces
-        str.append(numSpaces, ' ');
+// String generator
+template<>
+Gen<std::string> arbitrary<std::string>();
 
-        // shuffle the string to distribute spaces and characters more randomly
-        std::shuffle(str.begin(), str.end(), gen);
+// bool generator
+template<>
+Gen<bool> arbitrary<bool>();
 
-        // replace spaces > 5
-        size_t pos = 0;
-        while ((pos = str.find("      ", pos)) != std::string::npos) {
-            str.replace(pos, 6, "     "); // replace
-            pos += 5;
-        }
+// int list generator
+template<>
+Gen<std::vector<int>> arbitrary<std::vector<int>>();
 
-        return str;
-    }};
-}
+// string list generator
+template<>
+Gen<std::vector<std::string>> arbitrary<std::vector<std::string>>();
+
+// Person generator
+template<>
+Gen<Role> arbitrary<Role>();
 
-// bool generator
 template<>
-Gen<bool> arbitrary<bool>() {
-    return {[]() {
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
-        static std::uniform_int_distribution<int> dis(0, 1);
-        return static_cast<bool>(dis(gen));
+Gen<Person> arbitrary<Person>();
+
+// Instantiated in Gen.cpp for the built-in types
+extern template class Gen<int>;
+extern template class Gen<unsigned int>;
+extern template class Gen<char>;
+extern template class Gen<std::string>;
+extern template class Gen<bool>;
+extern template class Gen<std::vector<int>>;
+extern template class Gen<std::vector<std::string>>;
+extern template class Gen<Role>;
+extern template class Gen<Person>;
+
+extern template Gen<int> elements<int>(std::vector<int>);
+extern template Gen<char> elements<char>(std::vector<char>);
+extern template Gen<std::string> elements<std::string>(std::vector<std::string>);
+extern template Gen<int> withEdgeCases<int>(Gen<int>, std::vector<int>);
+extern template Gen<unsigned int> withEdgeCases<unsigned int>(Gen<unsigned int>, std::vector<unsigned int>);
+extern template Gen<char> withEdgeCases<char>(Gen<char>, std::vector<char>);
+
+// Tuple generator, draws the elements left to right
+template<typename... Ts>
+Gen<std::tuple<Ts...>> tupleOf(Gen<Ts>... gens) {
+    return {[gens...]() mutable {
+        return std::tuple<Ts...>{gens.generate()...};
     }};
 }
 
-// int list generator
-template<>
-Gen<std::vector<int>> arbitrary<std::vector<int>>() {
-    return {[]() {
-        std::vector<int> result;
-        std::random_device rd;
-        std::mt19937 gen(rd());
-        std::uniform_int_distribution<int> lenDist(0, 10); // length
-
-        int length = lenDist(gen);
-        result.reserve(length); // reserve
-
-        for (int i = 0; i < length; ++i) {
-            result.push_back(arbitrary<int>().generate());
+// How one value of a recursive generator was built, kept in the case arena for shrinking
+template<typename T>
+struct Derivation {
+    Derivation(T value, const void* owner) : value(std::move(value)), owner(owner) {}
+
+    T value;
+    const void* owner;                   // the Recursion that built it
+    bool leaf = true;
+    Philox start;                        // rng() when the branch was entered
+    std::vector<const Derivation*> subs; // subvalues in the order the branch drew them
+    std::vector<Philox> afterSub;        // rng() after each subvalue
+};
+
+// Derivations generated on the calling thread in the current case, dropped when the case arena is reset
+template<typename T>
+std::vector<const Derivation<T>*>& caseDerivations() {
+    thread_local std::vector<const Derivation<T>*> roots;
+    thread_local size_t generation = 0;
+    if (generation != caseArena().generation()) {
+        roots.clear();
+        generation = caseArena().generation();
+    }
+    return roots;
+}
+
+// Equality if T has operator==, otherwise values never compare equal
+template<typename T>
+auto sameValue(const T& a, const T& b, int) -> decltype(static_cast<bool>(a == b)) {
+    return a == b;
+}
+
+template<typename T>
+bool sameValue(const T&, const T&, long) {
+    return false;
+}
+
+// Recursive generator definition, immutable and shared by all copies of the generator
+// The size budget lives on the stack of each generate() call.
+template<typename T>
+struct Recursion {
+    Gen<T> leaf;
+    std::function<T(Gen<T>&)> branch;
+    size_t maxSize;
+
+    Recursion(Gen<T> leaf, std::function<T(Gen<T>&)> branch, size_t maxSize) :
+            leaf(std::move(leaf)), branch(std::move(branch)), maxSize(maxSize) {}
+
+    T generate() {
+        std::uniform_int_distribution<size_t> size_dis(0, maxSize);
+        size_t budget = size_dis(rng());
+        const Derivation<T>* root = node(budget);
+        caseDerivations<T>().push_back(root);
+        return root->value;
+    }
+
+    // Smaller candidates for a value this generator built in the current case, smallest first:
+    // its leaves, its subvalues, then the value with one subvalue shrunk
+    std::vector<T> shrink(const T& value) {
+        std::vector<T> result;
+        const Derivation<T>* derivation = find(value);
+        if (!derivation) {
+            return result;
         }
 
+        std::vector<const Derivation<T>*> smaller = candidates(derivation);
+        std::vector<const Derivation<T>*>& roots = caseDerivations<T>();
+        for (const Derivation<T>* candidate : smaller) {
+            roots.push_back(candidate);
+            result.push_back(candidate->value);
+        }
         return result;
-    }};
-}
+    }
 
-// string list generator
-template<>
-Gen<std::vector<std::string>> arbitrary<std::vector<std::string>>() {
-    return {[]() {
-        std::vector<std::string> result;
-        std::random_device rd;
-        std::mt19937 gen(rd());
-        std::uniform_int_distribution<int> lenDist(0, 10); // length
-
-        int length = lenDist(gen);
-        result.reserve(length); // reserve
-
-        for (int i = 0; i < length; ++i) {
-            result.push_back(arbitrary<std::string>().generate());
+private:
+    const Derivation<T>* node(size_t& budget) {
+        if (budget == 0) {
+            return leafNode(leaf.generate());
+        }
+        --budget;
+
+        Philox start = rng();
+        std::vector<const Derivation<T>*> subs;
+        std::vector<Philox> afterSub;
+        Gen<T> sub = {[&]() {
+            const Derivation<T>* s = node(budget);
+            subs.push_back(s);
+            afterSub.push_back(rng());
+            return s->value;
+        }};
+        T value = branch(sub);
+        return branchNode(std::move(value), start, std::move(subs), std::move(afterSub));
+    }
+
+    const Derivation<T>* leafNode(T value) {
+        return caseArena().create<Derivation<T>>(std::move(value), this);
+    }
+
+    const Derivation<T>* branchNode(T value, const Philox& start, std::vector<const Derivation<T>*> subs,
+                                    std::vector<Philox> afterSub) {
+        Derivation<T>* derivation = caseArena().create<Derivation<T>>(std::move(value), this);
+        derivation->leaf = false;
+        derivation->start = start;
+        derivation->subs = std::move(subs);
+        derivation->afterSub = std::move(afterSub);
+        return derivation;
+    }
+
+    const Derivation<T>* find(const T& value) const {
+        const std::vector<const Derivation<T>*>& roots = caseDerivations<T>();
+        for (auto it = roots.rbegin(); it != roots.rend(); ++it) {
+            if ((*it)->owner != this) {
+                continue;
+            }
+            if (const Derivation<T>* found = findIn(*it, value)) {
+                return found;
+            }
+        }
+        return nullptr;
+    }
+
+    static const Derivation<T>* findIn(const Derivation<T>* derivation, const T& value) {
+        if (sameValue(derivation->value, value, 0)) {
+            return derivation;
+        }
+        for (const Derivation<T>* s : derivation->subs) {
+            if (const Derivation<T>* found = findIn(s, value)) {
+                return found;
+            }
+        }
+        return nullptr;
+    }
+
+    static void collectLeaves(const Derivation<T>* derivation, std::vector<const Derivation<T>*>& leaves) {
+        if (derivation->leaf) {
+            for (const Derivation<T>* l : leaves) {
+                if (sameValue(l->value, derivation->value, 0)) {
+                    return;
+                }
+            }
+            leaves.push_back(derivation);
+            return;
+        }
+        for (const Derivation<T>* s : derivation->subs) {
+            collectLeaves(s, leaves);
+        }
+    }
+
+    std::vector<const Derivation<T>*> candidates(const Derivation<T>* derivation) {
+        std::vector<const Derivation<T>*> result;
+        if (derivation->leaf) {
+            for (T& value : leaf.shrinkValue(derivation->value)) {
+                result.push_back(leafNode(std::move(value)));
+            }
+            return result;
         }
 
+        collectLeaves(derivation, result);
+        result.insert(result.end(), derivation->subs.begin(), derivation->subs.end());
+        for (size_t i = 0; i < derivation->subs.size(); ++i) {
+            for (const Derivation<T>* smaller : candidates(derivation->subs[i])) {
+                result.push_back(rebuild(derivation, i, smaller));
+            }
+        }
         return result;
-    }};
-}
+    }
 
+    // The branch replayed from its recorded random state, with subvalue `index` replaced
+    const Derivation<T>* rebuild(const Derivation<T>* derivation, size_t index, const Derivation<T>* replacement) {
+        Philox saved = rng();
+        rng() = derivation->start;
+
+        std::vector<const Derivation<T>*> subs;
+        std::vector<Philox> afterSub;
+        Gen<T> sub = {[&]() {
+            size_t i = subs.size();
+            const Derivation<T>* s;
+            if (i < derivation->subs.size()) {
+                s = i == index ? replacement : derivation->subs[i];
+                rng() = derivation->afterSub[i];
+            } else {
+                s = leafNode(leaf.generate()); // the branch draws more subvalues than before
+            }
+            subs.push_back(s);
+            afterSub.push_back(rng());
+            return s->value;
+        }};
+        T value = branch(sub);
+
+        rng() = saved;
+        return branchNode(std::move(value), derivation->start, std::move(subs), std::move(afterSub));
+    }
+};
 
-// Person generator
-template<>
-Gen<Role> arbitrary<Role>() {
-    return {[]() {
-        Role role;
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
-        static std::uniform_int_distribution<int> dis(0, 1);
-        role = static_cast<Role>(dis(gen));
-        return role;
-    }};
+// Recursive generator for tree-shaped types (ASTs, documents, nested lists)
+// `branch` builds one node from a generator of its subvalues. All nodes of one value
+// share a budget of 0 to maxSize branches; once it is spent only leaves are generated.
+// How each value was built is kept in the case arena, so failing values shrink to
+// one of their leaves, one of their subvalues, or the same value with a subvalue shrunk
+// (for types with operator==).
+// Outside a runner the arena is not reset between values, use an ArenaScope to bound memory.
+template<typename T>
+Gen<T> recursive(Gen<T> leaf, std::function<T(Gen<T>&)> branch, const size_t maxSize = 20) {
+    std::shared_ptr<Recursion<T>> recursion = std::make_shared<Recursion<T>>(leaf, branch, maxSize);
+    return {[recursion]() {
+                return recursion->generate();
+            },
+            [recursion](const T& value) {
+                return recursion->shrink(value);
+            }};
 }
 
-template<>
-Gen<Person> arbitrary<Person>() {
-    return {[]() {
-        Person person;
-        person.firstName = arbitrary<std::string>().generate();
-        person.lastName = arbitrary<std::string>().generate();
-        person.age = arbitrary<unsigned int>().generate();
-        person.role = arbitrary<Role>().generate();
-        return person;
-    }};
+// Tree generator with nodes from the case arena, shrinks by replacing subtrees with smaller ones
+// Outside a runner the arena is not reset between values, use an ArenaScope to bound memory.
+template<typename T>
+Gen<Tree<T>> tree(Gen<T> value, const size_t maxNodes = 20, const size_t maxChildren = 3) {
+    return {[value, maxNodes, maxChildren]() mutable {
+                return generateTree<T>([&]() { return value.generate(); }, maxNodes, maxChildren, caseArena());
+            },
+            [](const Tree<T>& t) {
+                return shrinkTree(t, caseArena());
+            }};
 }
 
+// Generator for the arguments of a property, a tuple if there are several
+template<typename T, typename... Ts>
+struct ArbitraryArgs {
+    typedef std::tuple<T, Ts...> type;
+    static Gen<type> gen() { return tupleOf(arbitrary<T>(), arbitrary<Ts>()...); }
+};
+
+template<typename T>
+struct ArbitraryArgs<T> {
+    typedef T type;
+    static Gen<T> gen() { return arbitrary<T>(); }
+};
+
 
 // QuickCheck function
 template<typename T>
-void quickCheck(bool (*p)(T), const size_t n = 20) {
+bool quickCheck(bool (*p)(T), const CheckConfig& config) {
     Gen<T> g = arbitrary<T>();
+    return runProperty<T>(config, [&]() { return g.generate(); },
+                          [&](const T& v) { return g.shrinkValue(v); }, g.mutate, p);
+}
 
-    for (size_t i = 0; i < n; ++i) {
-        T value = g.generate();
-        bool result = p(value);
-        if (result) {
-            std::cout << "[       OK ] value: " << value << std::endl;
-        } else {
-            std::cout << "[   Failed ] value: " << value << std::endl;
-        }
-    }
+template<typename T>
+bool quickCheck(bool (*p)(T), const size_t n = 20) {
+    return quickCheck(p, CheckConfig(n));
+}
+
+// QuickCheck for any callable, e.g. lambdas with captures or properties taking const T&
+// Generated values are passed by reference; several types generate several arguments.
+template<typename T, typename... Ts, typename P,
+         typename = typename std::enable_if<sizeof...(Ts) != 0 || !IsPropertyPointer<P, T>::value>::type>
+bool quickCheck(P&& p, const CheckConfig& config) {
+    typedef typename ArbitraryArgs<T, Ts...>::type Args;
+    Gen<Args> g = ArbitraryArgs<T, Ts...>::gen();
+    return runProperty<Args>(config, [&]() { return g.generate(); },
+                             [&](const Args& v) { return g.shrinkValue(v); }, g.mutate, p);
+}
+
+template<typename T, typename... Ts, typename P,
+         typename = typename std::enable_if<sizeof...(Ts) != 0 || !IsPropertyPointer<P, T>::value>::type>
+bool quickCheck(P&& p, const size_t n = 20) {
+    return quickCheck<T, Ts...>(p, CheckConfig(n));
+}
+
+// QuickCheck with a custom generator
+template<typename T, typename P>
+bool quickCheck(Gen<T> g, P&& p, const CheckConfig& config) {
+    return runProperty<T>(config, [&]() { return g.generate(); },
+                          [&](const T& v) { return g.shrinkValue(v); }, g.mutate, p);
+}
+
+template<typename T, typename P>
+bool quickCheck(Gen<T> g, P&& p, const size_t n = 20) {
+    return quickCheck(g, p, CheckConfig(n));
 }
 
 #endif // GEN_H
@@ -1 +1,155 @@
 #include "GenOO.h"
+
+template class GenOO<int>;
+template class GenOO<std::string>;
+template class GenOO<bool>;
+template class GenOO<std::vector<std::string>>;
+template class GenOO<Person>;
+
+
+// Integer generator
+int IntGen::generate() {
+    // edge cases: bounds, 0 and ±1 if in range
+    if (pickEdgeCase()) {
+        std::vector<int> edges = {min, max};
+        for (int v : {0, 1, -1}) {
+            if (v > min && v < max) {
+                edges.push_back(v);
+            }
+        }
+        std::uniform_int_distribution<size_t> edge_dis(0, edges.size() - 1);
+        return edges[edge_dis(rng())];
+    }
+
+    std::uniform_int_distribution<int> dis(min, max);
+    return dis(rng());
+}
+
+void IntGen::mutate(int& value) {
+    mutateInt(value, min, max);
+}
+
+// String generator
+std::string StringGen::generate() {
+    std::uniform_int_distribution<size_t> len_dis(minLen, maxLen);
+    std::uniform_int_distribution<char> char_dis(minChar, maxChar);
+    std::uniform_int_distribution<size_t> space_dis(minSpaces, maxSpaces);
+
+    size_t length = len_dis(rng());
+
+    // edge cases: min length, all spaces, max length
+    if (pickEdgeCase()) {
+        std::uniform_int_distribution<int> kind_dis(0, 2);
+        switch (kind_dis(rng())) {
+            case 0:
+                length = minLen;
+                break;
+            case 1:
+                return std::string(length, ' ');
+            default:
+                length = maxLen;
+        }
+    }
+
+    size_t numSpaces = 0;
+    size_t numChars = 0;
+
+    if(length > 0) {
+        numSpaces = space_dis(rng());
+        numSpaces = numSpaces >= length ? length - 1: numSpaces;
+        numChars = length - numSpaces;
+    }
+
+    std::string str;
+    str.reserve(length);
+
+    // generate chars and append them
+    for (size_t i = 0; i < numChars; ++i) {
+        str.append(1, char_dis(rng()));
+    }
+
+    // append spaces
+    str.append(numSpaces, ' ');
+
+    // shuffle the string to distribute spaces and characters more randomly
+    std::shuffle(str.begin(), str.end(), rng());
+
+    // replace spaces > 5
+    size_t pos = 0;
+    while ((pos = str.find("      ", pos)) != std::string::npos) {
+        str.replace(pos, 6, "     "); // replace
+        pos += 5;
+    }
+
+    return str;
+}
+
+void StringGen::mutate(std::string& str) {
+    mutateString(str, minLen, maxLen, minChar, maxChar);
+}
+
+// Boolean generator
+bool BoolGen::generate() {
+    std::uniform_int_distribution<int> dis(0, 1);
+    return dis(rng()) == 1;
+}
+
+void BoolGen::mutate(bool& value) {
+    value = !value;
+}
+
+// String list generator
+std::vector<std::string> VectorStringGen::generate() {
+    std::vector<std::string> result;
+    std::uniform_int_distribution<uint16_t> lenDist(0, maxLen); // length
+
+    int length = lenDist(rng());
+    if (pickEdgeCase()) {
+        std::uniform_int_distribution<int> edge_dis(0, 2);
+        int edges[] = {0, 1, maxLen}; // edge cases: empty, single, max length
+        length = std::min<int>(edges[edge_dis(rng())], maxLen);
+    }
+    result.reserve(length); // reserve
+
+    for (int i = 0; i < length; ++i) {
+        result.push_back(stringGen.generate());
+    }
+
+    return result;
+}
+
+void VectorStringGen::mutate(std::vector<std::string>& list) {
+    mutateVector(list, maxLen,
+                 [this](std::string& str) { stringGen.mutate(str); },
+                 [this]() { return stringGen.generate(); });
+}
+
+// Person generator
+Person PersonGen::generate() {
+    Person person;
+    person.firstName = firstNameGen.generate();
+    person.lastName = lastNameGen.generate();
+    person.age = ageGen.generate();
+    person.role = static_cast<Role>(roleGen.generate());
+    return person;
+}
+
+void PersonGen::mutate(Person& person) {
+    std::uniform_int_distribution<int> op_dis(0, 4);
+    switch (op_dis(rng())) {
+        case 0:
+            std::swap(person.firstName, person.lastName);
+            break;
+        case 1:
+            firstNameGen.mutate(person.firstName);
+            break;
+        case 2:
+            lastNameGen.mutate(person.lastName);
+            break;
+        case 3:
+            ageGen.mutate(person.age);
+            break;
+        default:
+            person.role = person.role == STUDENT ? TEACHER : STUDENT;
+    }
+}
@@ -2,18 +2,82 @@
 #define GENOO_H
 
 #include "Person.h"
+#include "Check/Check.h"
+#include "Random/Random.h"
+#include "Arena/Arena.h"
+#include "Tree/Tree.h"
 
 #include <random>
+#include <stdexcept>
 #include <string>
 #include <algorithm>
+#include <functional>
 #include <iostream>
+#include <tuple>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 // Base generator class
 template<typename T>
 class GenOO {
 public:
     virtual T generate() = 0;
+
+    // Smaller candidates for a failing value, none by default
+    virtual std::vector<T> shrink(const T&) { return {}; }
+
+    // In-place change of a value within the domain of generate(), used by the mutation mode
+    // Generators that cannot mutate (the default) always draw fresh values.
+    virtual bool canMutate() const { return false; }
+    virtual void mutate(T&) {}
+};
+
+// Mutate hook of g for the runner, empty if g cannot mutate
+template<typename T>
+std::function<void(T&)> mutatorOf(GenOO<T>* g) {
+    if (!g->canMutate()) {
+        return {};
+    }
+    return [g](T& value) { g->mutate(value); };
+}
+
+// Instantiated in GenOO.cpp for the built-in generators
+extern template class GenOO<int>;
+extern template class GenOO<std::string>;
+extern template class GenOO<bool>;
+extern template class GenOO<std::vector<std::string>>;
+extern template class GenOO<Person>;
+
+
+// Weighted generator, picks one of the generators with a probability proportional to its weight
+template<typename T>
+class FrequencyGen : public GenOO<T> {
+private:
+    std::vector<std::pair<unsigned int, GenOO<T>*>> gens;
+    unsigned int total = 0;
+
+public:
+    FrequencyGen(std::vector<std::pair<unsigned int, GenOO<T>*>> gens) : gens(std::move(gens)) {
+        for (const auto& g : this->gens) {
+            total += g.first;
+        }
+        if (total == 0) {
+            throw std::invalid_argument("FrequencyGen: weights sum to zero");
+        }
+    }
+
+    T generate() override {
+        std::uniform_int_distribution<unsigned int> dis(0, total - 1);
+        unsigned int pick = dis(rng());
+        for (auto& g : gens) {
+            if (pick < g.first) {
+                return g.second->generate();
+            }
+            pick -= g.first;
+        }
+        return gens.back().second->generate();
+    }
 };
 
 
@@ -29,12 +93,9 @@ public:
     IntGen() = default;
     IntGen(const int min, const int max) : min(min), max(max) {}
 
-    int generate() override {
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
-        static std::uniform_int_distribution<int> dis(min, max);
-        return dis(gen);
-    }
+    int generate() override;
+    bool canMutate() const override { return true; }
+    void mutate(int& value) override;
 };
 
 // String generator
@@ -52,46 +113,9 @@ public:
     StringGen(const size_t minLen, const size_t maxLen, const char minChar, const char maxChar) :
             minLen(minLen), maxLen(maxLen), minChar(minChar), maxChar(maxChar) {}
 
-    std::string generate() override {
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
-        static std::uniform_int_distribution<size_t> len_dis(minLen, maxLen);
-        static std::uniform_int_distribution<char> char_dis(minChar, maxChar);
-        static std::uniform_int_distribution<size_t> space_dis(minSpaces, maxSpaces);
-
-        size_t length = len_dis(gen);
-        size_t numSpaces = 0;
-        size_t numChars = 0;
-
-        if(length > 0) {
-            numSpaces = space_dis(gen);
-            numSpaces = numSpaces >= length ? length - 1: numSpaces;
-            numChars = length - numSpaces;
-        }
-
-        std::string str;
-        str.reserve(length);
-
-        // generate chars and append them
-        for (size_t i = 0; i < numChars; ++i) {
-            str.append(1, char_dis(gen));
-        }
-
-        // append spaces
-        str.append(numSpaces, ' ');
-
-        // shuffle the string to distribute spaces and characters more randomly
-        std::shuffle(str.begin(), str.end(), gen);
-
-        // replace spaces > 5
-        size_t pos = 0;
-        while ((pos = str.find("      ", pos)) != std::string::npos) {
-            str.replace(pos, 6, "     "); // replace
-            pos += 5;
-        }
-
-        return str;
-    }
+    std::string generate() override;
+    bool canMutate() const override { return true; }
+    void mutate(std::string& str) override;
 };
 
 // Boolean generator
@@ -99,12 +123,9 @@ class BoolGen : public GenOO<bool> {
 public:
     BoolGen() = default;
 
-    bool generate() override {
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
-        static std::uniform_int_distribution<int> dis(0, 1);
-        return dis(gen) == 1;
-    }
+    bool generate() override;
+    bool canMutate() const override { return true; }
+    void mutate(bool& value) override;
 };
 
 
@@ -117,21 +138,9 @@ public:
     VectorStringGen(StringGen stringGen, const uint16_t maxLen) :
             stringGen(std::move(stringGen)), maxLen(maxLen) {};
 
-    std::vector<std::string> generate() override {
-        std::vector<std::string> result;
-        std::random_device rd;
-        std::mt19937 gen(rd());
-        std::uniform_int_distribution<uint16_t> lenDist(0, maxLen); // length
-
-        int length = lenDist(gen);
-        result.reserve(length); // reserve
-
-        for (int i = 0; i < length; ++i) {
-            result.push_back(stringGen.generate());
-        }
-
-        return result;
-    }
+    std::vector<std::string> generate() override;
+    bool canMutate() const override { return true; }
+    void mutate(std::vector<std::string>& list) override;
 };
 
 
@@ -146,35 +155,84 @@ private:
 public:
     PersonGen() : firstNameGen(), lastNameGen(), ageGen(0, 100), roleGen(0, 1) {}
 
-    Person generate() override {
-        Person person;
-        person.firstName = firstNameGen.generate();
-        person.lastName = lastNameGen.generate();
-        person.age = ageGen.generate();
-        person.role = static_cast<Role>(roleGen.generate());
-        return person;
+    Person generate() override;
+    bool canMutate() const override { return true; }
+    void mutate(Person& person) override;
+};
+
+
+
+// Tuple generator, draws the elements left to right
+template<typename... Ts>
+class TupleGen : public GenOO<std::tuple<Ts...>> {
+private:
+    std::tuple<GenOO<Ts>*...> gens;
+
+    template<size_t... Is>
+    std::tuple<Ts...> generateAll(IndexSequence<Is...>) {
+        return std::tuple<Ts...>{std::get<Is>(gens)->generate()...};
+    }
+
+public:
+    TupleGen(GenOO<Ts>*... gens) : gens(gens...) {}
+
+    std::tuple<Ts...> generate() override {
+        return generateAll(typename MakeIndexSequence<sizeof...(Ts)>::type());
+    }
+};
+
+
+
+// Tree generator with nodes from the case arena, shrinks by replacing subtrees with smaller ones
+// Outside a runner the arena is not reset between values, use an ArenaScope to bound memory.
+template<typename T>
+class TreeGen : public GenOO<Tree<T>> {
+private:
+    GenOO<T>* valueGen;
+    size_t maxNodes = 20;
+    size_t maxChildren = 3;
+
+public:
+    TreeGen(GenOO<T>* valueGen) : valueGen(valueGen) {}
+    TreeGen(GenOO<T>* valueGen, const size_t maxNodes, const size_t maxChildren) :
+            valueGen(valueGen), maxNodes(maxNodes), maxChildren(maxChildren) {}
+
+    Tree<T> generate() override {
+        return generateTree<T>([this]() { return valueGen->generate(); }, maxNodes, maxChildren, caseArena());
+    }
+
+    std::vector<Tree<T>> shrink(const Tree<T>& tree) override {
+        return shrinkTree(tree, caseArena());
     }
 };
 
 
 
 // QuickCheck function
+template<typename T>
+bool quickCheckOO(GenOO<T>* g, bool (*p)(T), const CheckConfig& config) {
+    return runProperty<T>(config, [&]() { return g->generate(); },
+                          [&](const T& v) { return g->shrink(v); }, mutatorOf(g), p);
+}
+
 template<typename T>
 bool quickCheckOO(GenOO<T>* g, bool (*p)(T), const size_t n = 20) {
-    bool passed = true;
-
-    for (size_t i = 0; i < n; ++i) {
-        T value = g->generate();
-        bool result = p(value);
-        if (result) {
-            std::cout << "[       OK ] value: " << value << std::endl;
-        } else {
-            std::cout << "[   Failed ] value: " << value << std::endl;
-            passed = false;
-        }
-    }
+    return quickCheckOO(g, p, CheckConfig(n));
+}
+
+// QuickCheck for any callable, e.g. lambdas with captures or properties taking const T&
+// Generated values are passed by reference; TupleGen values are unpacked into several arguments.
+template<typename T, typename P,
+         typename = typename std::enable_if<!IsPropertyPointer<P, T>::value>::type>
+bool quickCheckOO(GenOO<T>* g, P&& p, const CheckConfig& config) {
+    return runProperty<T>(config, [&]() { return g->generate(); },
+                          [&](const T& v) { return g->shrink(v); }, mutatorOf(g), p);
+}
 
-    return passed;
+template<typename T, typename P,
+         typename = typename std::enable_if<!IsPropertyPointer<P, T>::value>::type>
+bool quickCheckOO(GenOO<T>* g, P&& p, const size_t n = 20) {
+    return quickCheckOO(g, p, CheckConfig(n));
 }
 
 #endif // GENOO_H
@@ -0,0 +1,113 @@
+#include "Mutate.h"
+
+#include <algorithm>
+
+namespace {
+    const size_t MAX_SPACE_RUN = 5; // generated strings never have more spaces in a row
+
+    // Small non-zero step
+    int delta() {
+        int step = std::uniform_int_distribution<int>(-8, 7)(rng());
+        return step >= 0 ? step + 1 : step;
+    }
+
+    // Spaces directly before pos
+    size_t spacesBefore(const std::string& str, size_t pos) {
+        size_t n = 0;
+        while (pos > n && str[pos - n - 1] == ' ') {
+            ++n;
+        }
+        return n;
+    }
+
+    // Spaces starting at pos
+    size_t spacesFrom(const std::string& str, size_t pos) {
+        size_t n = 0;
+        while (pos + n < str.size() && str[pos + n] == ' ') {
+            ++n;
+        }
+        return n;
+    }
+
+    // A char from the charset, or a space if that keeps the run around `pos` short
+    char pickChar(const std::string& str, size_t before, size_t after, char minChar, char maxChar) {
+        std::uniform_int_distribution<int> space_dis(0, 4);
+        if (space_dis(rng()) == 0 && spacesBefore(str, before) + spacesFrom(str, after) < MAX_SPACE_RUN) {
+            return ' ';
+        }
+        std::uniform_int_distribution<char> char_dis(minChar, maxChar);
+        return char_dis(rng());
+    }
+}
+
+void mutateInt(int& value, const int min, const int max) {
+    // widened, so steps and negation cannot overflow before clamping
+    long long v = value;
+    std::uniform_int_distribution<int> op_dis(0, 2);
+    switch (op_dis(rng())) {
+        case 0:
+            v += delta();
+            break;
+        case 1:
+            v = -v;
+            break;
+        default:
+            v = std::bernoulli_distribution(0.5)(rng()) ? min : max;
+    }
+    value = static_cast<int>(std::max<long long>(min, std::min<long long>(max, v)));
+}
+
+void mutateUnsigned(unsigned int& value, const unsigned int min, const unsigned int max) {
+    long long v = value;
+    std::uniform_int_distribution<int> op_dis(0, 1);
+    switch (op_dis(rng())) {
+        case 0:
+            v += delta();
+            break;
+        default:
+            v = std::bernoulli_distribution(0.5)(rng()) ? min : max;
+    }
+    value = static_cast<unsigned int>(std::max<long long>(min, std::min<long long>(max, v)));
+}
+
+void mutateString(std::string& str, const size_t minLen, const size_t maxLen, const char minChar, const char maxChar) {
+    // operations that keep the length within bounds
+    int ops[3];
+    size_t numOps = 0;
+    if (!str.empty()) {
+        ops[numOps++] = 0;
+    }
+    if (str.size() < maxLen) {
+        ops[numOps++] = 1;
+    }
+    if (str.size() > minLen) {
+        ops[numOps++] = 2;
+    }
+    if (numOps == 0) {
+        return;
+    }
+
+    switch (ops[std::uniform_int_distribution<size_t>(0, numOps - 1)(rng())]) {
+        case 0: {
+            size_t pos = std::uniform_int_distribution<size_t>(0, str.size() - 1)(rng());
+            str[pos] = pickChar(str, pos, pos + 1, minChar, maxChar);
+            break;
+        }
+        case 1: {
+            size_t pos = std::uniform_int_distribution<size_t>(0, str.size())(rng());
+            str.insert(pos, 1, pickChar(str, pos, pos, minChar, maxChar));
+            break;
+        }
+        default: {
+            size_t pos = std::uniform_int_distribution<size_t>(0, str.size() - 1)(rng());
+            size_t maxErase = std::min<size_t>({4, str.size() - pos, str.size() - minLen});
+            size_t len = std::uniform_int_distribution<size_t>(1, maxErase)(rng());
+            // erasing between two runs of spaces must not join them into a long one
+            size_t before = spacesBefore(str, pos);
+            size_t after = spacesFrom(str, pos + len);
+            if (before == 0 || after == 0 || before + after <= MAX_SPACE_RUN) {
+                str.erase(pos, len);
+            }
+        }
+    }
+}
@@ -0,0 +1,138 @@
+#ifndef MUTATE_H
+#define MUTATE_H
+
+#include "Random/Random.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Cheap in-place mutations for the generators' mutate hooks (Gen::mutate, GenOO::mutate)
+// Every helper keeps the value inside the bounds it is given, so mutated cases stay in the generator's domain.
+void mutateInt(int& value, int min, int max);                          // small steps, negation, jumps to a bound
+void mutateUnsigned(unsigned int& value, unsigned int min, unsigned int max);
+void mutateString(std::string& str, size_t minLen, size_t maxLen,      // char replacements, insertions, deletions
+                  char minChar, char maxChar);                         // with chars from [minChar, maxChar] or spaces
+
+// Element insertion, splicing, removal, swaps and element mutations, the size stays at most maxLen
+template<typename T, typename M, typename G>
+void mutateVector(std::vector<T>& values, const size_t maxLen, M&& mutateElement, G&& generateElement) {
+    size_t room = values.size() < maxLen ? maxLen - values.size() : 0;
+    if (values.empty()) {
+        if (room > 0) {
+            values.push_back(generateElement());
+        }
+        return;
+    }
+
+    std::uniform_int_distribution<size_t> pos_dis(0, values.size() - 1);
+    std::uniform_int_distribution<int> op_dis(0, 4);
+    size_t pos = pos_dis(rng());
+    int op = op_dis(rng());
+    if (op <= 1 && room == 0) {
+        op = 4;
+    }
+
+    switch (op) {
+        case 0:
+            values.insert(values.begin() + std::uniform_int_distribution<size_t>(0, values.size())(rng()),
+                          generateElement());
+            break;
+        case 1: {
+            // splice a copy of up to 4 elements to another position
+            size_t count = std::min<size_t>({4, values.size() - pos, room});
+            size_t last = std::uniform_int_distribution<size_t>(pos + 1, pos + count)(rng());
+            size_t to = std::uniform_int_distribution<size_t>(0, values.size())(rng());
+            std::vector<T> range(values.begin() + pos, values.begin() + last);
+            values.insert(values.begin() + to, range.begin(), range.end());
+            break;
+        }
+        case 2:
+            values.erase(values.begin() + pos);
+            break;
+        case 3:
+            std::swap(values[pos], values[pos_dis(rng())]);
+            break;
+        default:
+            mutateElement(values[pos]);
+    }
+}
+
+
+// Pool of earlier inputs for the mutation mode
+// With probability `ratio` a case is derived from a pooled input, which is moved out,
+// mutated in place by the generator's mutate hook and stored back afterwards, so its allocations are reused.
+// Otherwise the case is drawn fresh and stored in the next ring slot.
+// Without a mutate hook every case is drawn fresh.
+template<typename T>
+class MutationPool {
+private:
+    std::vector<T> pool;
+    size_t capacity;
+    double ratio;
+    std::function<void(T&)> mutate;
+    size_t nextSlot = 0;
+    size_t takenSlot = 0;
+    bool taken = false;
+
+    // Key of the stream deciding which cases are mutations, apart from the case streams
+    static const uint64_t DECISION_KEY = 0x6d75746174696f6eull;
+
+    bool enabled() const {
+        return mutate && ratio > 0.0 && capacity > 0;
+    }
+
+public:
+    MutationPool(const size_t capacity, const double ratio, std::function<void(T&)> mutate) :
+            capacity(capacity), ratio(ratio), mutate(std::move(mutate)) {}
+
+    // Decides whether case `caseIndex` is a mutation and of which pooled input
+    // Drawn from a stream of its own, so fresh cases get the same values as when run alone.
+    bool pickMutation(const uint64_t seed, const uint32_t propertyId, const uint64_t caseIndex) {
+        if (!enabled() || pool.empty()) {
+            return false;
+        }
+
+        Philox decisions(seed ^ DECISION_KEY, propertyId, caseIndex);
+        std::bernoulli_distribution dis(ratio);
+        if (!dis(decisions)) {
+            return false;
+        }
+        std::uniform_int_distribution<size_t> slot_dis(0, pool.size() - 1);
+        takenSlot = slot_dis(decisions);
+        taken = true;
+        return true;
+    }
+
+    // The input picked by pickMutation, mutated with the case's stream
+    T takeMutated() {
+        T value = std::move(pool[takenSlot]);
+        mutate(value);
+        return value;
+    }
+
+    void keep(T&& value) {
+        if (!enabled()) {
+            return;
+        }
+
+        if (taken) {
+            pool[takenSlot] = std::move(value);
+            taken = false;
+        } else if (pool.size() < capacity) {
+            pool.push_back(std::move(value));
+        } else {
+            pool[nextSlot] = std::move(value);
+            nextSlot = (nextSlot + 1) % capacity;
+        }
+    }
+
+    size_t size() const { return pool.size(); }
+};
+
+#endif // MUTATE_H
@@ -0,0 +1,102 @@
+#include "Random.h"
+
+#include <random>
+
+namespace {
+    const uint32_t PHILOX_M0 = 0xD2511F53;
+    const uint32_t PHILOX_M1 = 0xCD9E8D57;
+    const uint32_t PHILOX_W0 = 0x9E3779B9;
+    const uint32_t PHILOX_W1 = 0xBB67AE85;
+
+    void philoxRound(uint32_t* ctr, const uint32_t* key) {
+        uint64_t p0 = static_cast<uint64_t>(PHILOX_M0) * ctr[0];
+        uint64_t p1 = static_cast<uint64_t>(PHILOX_M1) * ctr[2];
+        uint32_t c0 = static_cast<uint32_t>(p1 >> 32) ^ ctr[1] ^ key[0];
+        uint32_t c1 = static_cast<uint32_t>(p1);
+        uint32_t c2 = static_cast<uint32_t>(p0 >> 32) ^ ctr[3] ^ key[1];
+        uint32_t c3 = static_cast<uint32_t>(p0);
+        ctr[0] = c0;
+        ctr[1] = c1;
+        ctr[2] = c2;
+        ctr[3] = c3;
+    }
+
+    Philox& threadStream() {
+        thread_local Philox stream(randomSeed(), 0, 0);
+        return stream;
+    }
+
+    double& threadEdgeCaseRatio() {
+        thread_local double ratio = DEFAULT_EDGE_CASE_RATIO;
+        return ratio;
+    }
+}
+
+Philox::Philox(uint64_t seed, uint32_t propertyId, uint64_t caseIndex) {
+    key[0] = static_cast<uint32_t>(seed);
+    key[1] = static_cast<uint32_t>(seed >> 32);
+    counter[0] = 0;
+    counter[1] = propertyId;
+    counter[2] = static_cast<uint32_t>(caseIndex);
+    counter[3] = static_cast<uint32_t>(caseIndex >> 32);
+}
+
+Philox::result_type Philox::operator()() {
+    if (next == 4) {
+        uint32_t k[2] = {key[0], key[1]};
+        for (int i = 0; i < 4; ++i) {
+            block[i] = counter[i];
+        }
+
+        // 10 rounds with key schedule
+        for (int round = 0; round < 10; ++round) {
+            philoxRound(block, k);
+            k[0] += PHILOX_W0;
+            k[1] += PHILOX_W1;
+        }
+
+        ++counter[0];
+        next = 0;
+    }
+
+    return block[next++];
+}
+
+Philox& rng() {
+    return threadStream();
+}
+
+void seedCase(uint64_t seed, uint32_t propertyId, uint64_t caseIndex) {
+    threadStream() = Philox(seed, propertyId, caseIndex);
+}
+
+uint64_t randomSeed() {
+    std::random_device rd;
+    return (static_cast<uint64_t>(rd()) << 32) | rd();
+}
+
+uint32_t propertyId(const std::string& name) {
+    uint32_t hash = 2166136261u;
+    for (char c : name) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+double edgeCaseRatio() {
+    return threadEdgeCaseRatio();
+}
+
+void setEdgeCaseRatio(double ratio) {
+    threadEdgeCaseRatio() = ratio;
+}
+
+bool pickEdgeCase() {
+    double ratio = threadEdgeCaseRatio();
+    if (ratio <= 0.0) {
+        return false;
+    }
+    std::bernoulli_distribution dis(ratio);
+    return dis(rng());
+}
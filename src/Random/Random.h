@@ -0,0 +1,67 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <cstdint>
+#include <limits>
+#include <string>
+
+// Philox4x32-10 counter-based random engine
+// Every block of output is a pure function of (key, counter), so the stream
+// of any test case can be computed directly from (seed, property id, case index)
+// without generating the cases before it.
+class Philox {
+public:
+    typedef uint32_t result_type;
+
+    Philox() : Philox(0, 0, 0) {}
+    Philox(uint64_t seed, uint32_t propertyId, uint64_t caseIndex);
+
+    static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()();
+
+private:
+    uint32_t key[2];
+    uint32_t counter[4]; // block index, property id, case index (low, high)
+    uint32_t block[4];
+    unsigned next = 4;
+};
+
+// Random stream of the calling thread, used by all built-in generators
+Philox& rng();
+
+// Positions the calling thread's stream at the start of case `caseIndex` of property `propertyId`
+void seedCase(uint64_t seed, uint32_t propertyId, uint64_t caseIndex);
+
+// Fresh non-deterministic seed
+uint64_t randomSeed();
+
+// Stable id for a property name (FNV-1a)
+uint32_t propertyId(const std::string& name);
+
+// Edge case injection policy
+// Built-in generators return one of their edge cases (bounds, 0, ±1, empty, ...)
+// with this probability instead of a uniform draw.
+const double DEFAULT_EDGE_CASE_RATIO = 0.1;
+
+double edgeCaseRatio();
+void setEdgeCaseRatio(double ratio);
+
+// Draws from rng() whether the next value should be an edge case
+bool pickEdgeCase();
+
+// Sets the edge case ratio of the calling thread, the previous one is restored on destruction
+class EdgeCaseRatioScope {
+public:
+    explicit EdgeCaseRatioScope(const double ratio) : previous(edgeCaseRatio()) { setEdgeCaseRatio(ratio); }
+    ~EdgeCaseRatioScope() { setEdgeCaseRatio(previous); }
+
+    EdgeCaseRatioScope(const EdgeCaseRatioScope&) = delete;
+    EdgeCaseRatioScope& operator=(const EdgeCaseRatioScope&) = delete;
+
+private:
+    double previous;
+};
+
+#endif // RANDOM_H
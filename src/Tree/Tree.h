@@ -0,0 +1,160 @@
+#ifndef TREE_H
+#define TREE_H
+
+#include "Arena/Arena.h"
+#include "Random/Random.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <ostream>
+#include <random>
+#include <vector>
+
+// Node of a generated tree, allocated from an Arena
+template<typename T>
+struct TreeNode {
+    T value;
+    const TreeNode* const* children = nullptr;
+    size_t numChildren = 0;
+};
+
+// Tree-shaped value; a handle to nodes owned by the case arena
+template<typename T>
+struct Tree {
+    const TreeNode<T>* root = nullptr;
+
+    size_t size() const { return size(root); }
+    size_t depth() const { return depth(root); }
+
+    friend std::ostream& operator<<(std::ostream& os, const Tree& tree) {
+        print(os, tree.root);
+        return os;
+    }
+
+private:
+    static size_t size(const TreeNode<T>* node) {
+        if (!node) {
+            return 0;
+        }
+        size_t result = 1;
+        for (size_t i = 0; i < node->numChildren; ++i) {
+            result += size(node->children[i]);
+        }
+        return result;
+    }
+
+    static size_t depth(const TreeNode<T>* node) {
+        if (!node) {
+            return 0;
+        }
+        size_t result = 0;
+        for (size_t i = 0; i < node->numChildren; ++i) {
+            result = std::max(result, depth(node->children[i]));
+        }
+        return result + 1;
+    }
+
+    static void print(std::ostream& os, const TreeNode<T>* node) {
+        if (!node) {
+            return;
+        }
+        os << node->value;
+        if (node->numChildren > 0) {
+            os << "(";
+            for (size_t i = 0; i < node->numChildren; ++i) {
+                os << (i > 0 ? ", " : "");
+                print(os, node->children[i]);
+            }
+            os << ")";
+        }
+    }
+};
+
+
+// Builds one subtree, every node takes one unit of the budget shared by all branches
+template<typename T, typename G>
+const TreeNode<T>* buildTreeNode(G& generateValue, size_t& budget, const size_t maxChildren, Arena& arena) {
+    --budget;
+    TreeNode<T>* node = arena.create<TreeNode<T>>();
+    node->value = generateValue();
+
+    std::uniform_int_distribution<size_t> children_dis(0, std::min(maxChildren, budget));
+    size_t numChildren = children_dis(rng());
+    const TreeNode<T>** children = arena.createArray<const TreeNode<T>*>(numChildren);
+
+    size_t i = 0;
+    for (; i < numChildren && budget > 0; ++i) {
+        children[i] = buildTreeNode<T>(generateValue, budget, maxChildren, arena);
+    }
+
+    node->children = children;
+    node->numChildren = i;
+    return node;
+}
+
+// Generates a tree of 1 to maxNodes nodes
+template<typename T, typename G>
+Tree<T> generateTree(G&& generateValue, const size_t maxNodes, const size_t maxChildren, Arena& arena) {
+    std::uniform_int_distribution<size_t> size_dis(1, std::max<size_t>(maxNodes, 1));
+    size_t budget = size_dis(rng());
+
+    Tree<T> tree;
+    tree.root = buildTreeNode<T>(generateValue, budget, maxChildren, arena);
+    return tree;
+}
+
+// Smaller candidates for a failing tree, smallest first:
+// a subtree in place of the tree, the tree without one subtree, the tree with one subtree shrunk
+template<typename T>
+std::vector<Tree<T>> shrinkTree(const Tree<T>& tree, Arena& arena) {
+    std::vector<Tree<T>> result;
+    const TreeNode<T>* root = tree.root;
+    if (!root) {
+        return result;
+    }
+
+    for (size_t i = 0; i < root->numChildren; ++i) {
+        Tree<T> subtree;
+        subtree.root = root->children[i];
+        result.push_back(subtree);
+    }
+
+    // copies the root with child `index` replaced, or removed if `replacement` is null
+    auto replaceChild = [&](size_t index, const TreeNode<T>* replacement) {
+        size_t numChildren = root->numChildren - (replacement ? 0 : 1);
+        const TreeNode<T>** children = arena.createArray<const TreeNode<T>*>(numChildren);
+        size_t n = 0;
+        for (size_t i = 0; i < root->numChildren; ++i) {
+            if (i != index) {
+                children[n++] = root->children[i];
+            } else if (replacement) {
+                children[n++] = replacement;
+            }
+        }
+
+        TreeNode<T>* node = arena.create<TreeNode<T>>();
+        node->value = root->value;
+        node->children = children;
+        node->numChildren = numChildren;
+
+        Tree<T> candidate;
+        candidate.root = node;
+        return candidate;
+    };
+
+    for (size_t i = 0; i < root->numChildren; ++i) {
+        result.push_back(replaceChild(i, nullptr));
+    }
+
+    for (size_t i = 0; i < root->numChildren; ++i) {
+        Tree<T> child;
+        child.root = root->children[i];
+        for (const Tree<T>& shrunk : shrinkTree(child, arena)) {
+            result.push_back(replaceChild(i, shrunk.root));
+        }
+    }
+
+    return result;
+}
+
+#endif // TREE_H
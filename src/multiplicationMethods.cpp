@@ -1,5 +1,7 @@
 #include "multiplicationMethods.h"
 
+#include <limits>
+
 int multiplyWithOperator(const int a, const int b) {
     return a * b;
 }
@@ -9,5 +11,16 @@ int multiplyWithLoop(const int a, const int b) {
     for (int i = 0; i < b; ++i) {
         result += a;
     }
+    for (int i = 0; i > b; --i) {
+        result -= a;
+    }
     return result;
+}
+
+bool squaresMatch(const int n) {
+    long long square = static_cast<long long>(n) * n;
+    if (square > std::numeric_limits<int>::max()) {
+        return true;
+    }
+    return multiplyWithOperator(n, n) == square && multiplyWithLoop(n, n) == square;
 }
\ No newline at end of file
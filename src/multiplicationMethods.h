@@ -4,4 +4,8 @@
 int multiplyWithOperator(int a, int b);
 int multiplyWithLoop(int a, int b);
 
+// Property shared by the test suites and seminar_cmin: both methods square n exactly
+// Squares that overflow int are skipped, they are undefined behaviour and would loop up to 2^31 times.
+bool squaresMatch(int n);
+
 #endif //MULTIPLICATION_METHODS_H
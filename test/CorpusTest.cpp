@@ -0,0 +1,111 @@
+#include "gtest/gtest.h"
+#include "Gen/Gen.h"
+#include "Corpus/Corpus.h"
+#include "Corpus/Minimize.h"
+#include "reverseMethods.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+
+// Encoded inputs decode to the same value
+TEST(CorpusTest, RoundTrip) {
+    Person person;
+    person.firstName = "Ja\tne";
+    person.lastName = "Do\\e\n";
+    person.age = -3;
+    person.role = TEACHER;
+
+    Person decoded;
+    ASSERT_TRUE(decode(encode(person), decoded));
+    ASSERT_EQ(decoded.firstName, person.firstName);
+    ASSERT_EQ(decoded.lastName, person.lastName);
+    ASSERT_EQ(decoded.age, person.age);
+    ASSERT_EQ(decoded.role, person.role);
+
+    std::vector<std::string> lists[] = {{}, {""}, {"a b", "", "\t"}};
+    for (const auto& list : lists) {
+        std::vector<std::string> decodedList;
+        ASSERT_TRUE(decode(encode(list), decodedList));
+        ASSERT_EQ(decodedList, list);
+    }
+
+    int n;
+    ASSERT_FALSE(decode("12x", n));
+    std::vector<std::string> list;
+    ASSERT_FALSE(decode("2\ta", list));
+}
+
+// Property function for corpus minimization
+bool reverseEqual(const std::string& str) {
+    return reverseWithStdReverse(str) == reverseWithSwap(str);
+}
+
+// Duplicates and inputs with an already seen signature are dropped, order is kept
+TEST(CorpusTest, Minimize) {
+    std::stringstream in;
+    in << encode(std::string("abc")) << '\n'
+       << encode(std::string("abc")) << '\n'
+       << encode(std::string("cba")) << '\n'
+       << encode(std::string(100, 'x')) << '\n'
+       << "bad\\q" << '\n';
+
+    std::stringstream out;
+    CorpusStats stats = minimizeCorpus<std::string>(in, out, reverseEqual, 4, 2);
+
+    ASSERT_EQ(stats.read, 5u);
+    ASSERT_EQ(stats.duplicates, 1u);
+    ASSERT_EQ(stats.malformed, 1u);
+    ASSERT_EQ(stats.redundant, 1u);
+    ASSERT_EQ(stats.kept, 2u);
+    ASSERT_EQ(out.str(), "abc\n" + std::string(100, 'x') + "\n");
+}
+
+// Runner inputs saved to a corpus file can be loaded again
+TEST(CorpusTest, SaveInputs) {
+    std::string path = ::testing::TempDir() + "corpus_person.txt";
+    std::remove(path.c_str());
+
+    CheckConfig config(50);
+    config.corpusFile = path;
+    quickCheck<Person>([](const Person& person) { return person.role == STUDENT || person.role == TEACHER; }, config);
+
+    std::ifstream in(path);
+    std::stringstream out;
+    CorpusStats stats = minimizeCorpus<Person>(in, out, [](const Person& person) {
+        return person.validateAge();
+    });
+
+    ASSERT_EQ(stats.read, 50u);
+    ASSERT_EQ(stats.malformed, 0u);
+    ASSERT_GT(stats.kept, 0u);
+    ASSERT_LT(stats.kept, 50u);
+}
+
+// Failing cases are saved as generated, not as shrunk
+TEST(CorpusTest, SaveBeforeShrinking) {
+    std::string path = ::testing::TempDir() + "corpus_shrink.txt";
+    std::remove(path.c_str());
+
+    Gen<int> g = {[]() {
+        std::uniform_int_distribution<int> dis(10, 20);
+        return dis(rng());
+    }, [](const int& n) {
+        return std::vector<int>{n - 1};
+    }};
+    CheckConfig config(10);
+    config.corpusFile = path;
+    ASSERT_FALSE(quickCheck(g, [](int n) { return n < 5; }, config));
+
+    std::ifstream in(path);
+    std::string line;
+    size_t read = 0;
+    while (std::getline(in, line)) {
+        int n;
+        ASSERT_TRUE(decode(line, n));
+        ASSERT_GE(n, 10);
+        ++read;
+    }
+    ASSERT_EQ(read, 10u);
+}
@@ -6,7 +6,7 @@
 
 // Property function for integer generator
 bool checkMultiplication(int n) {
-    return multiplyWithOperator(n, n) == multiplyWithLoop(n, n);
+    return squaresMatch(n);
 }
 
 // Test case for integer generator
@@ -98,3 +98,164 @@ TEST(QuickCheckOOTest, PersonTest) {
     bool passed = quickCheckOO(&personGen, checkingPersonAge);
     ASSERT_TRUE(passed);
 }
+
+
+// Reproducing a failure id regenerates the same input
+TEST(QuickCheckOOTest, ReproduceCase) {
+    PersonGen personGen;
+    CheckConfig config(100);
+
+    config.beginCase(57);
+    Person expected = personGen.generate();
+
+    CheckConfig single = CheckConfig::reproduce({config.seed, config.propertyId, 57});
+    single.beginCase(single.firstCase);
+    Person actual = personGen.generate();
+
+    ASSERT_EQ(expected.firstName, actual.firstName);
+    ASSERT_EQ(expected.lastName, actual.lastName);
+    ASSERT_EQ(expected.age, actual.age);
+    ASSERT_EQ(expected.role, actual.role);
+}
+
+
+// Edge cases stay within the configured bounds
+TEST(QuickCheckOOTest, IntGenEdgeCases) {
+    IntGen intGen(-10, 20);
+    EdgeCaseRatioScope edgeCases(1.0);
+
+    bool hitZero = false;
+    for (size_t i = 0; i < 100; ++i) {
+        int value = intGen.generate();
+        hitZero = hitZero || value == 0;
+        ASSERT_TRUE(value >= -10 && value <= 20);
+    }
+
+    ASSERT_TRUE(hitZero);
+}
+
+TEST(QuickCheckOOTest, FrequencyGenTest) {
+    IntGen small(0, 9);
+    IntGen large(1000, 2000);
+    FrequencyGen<int> gen({{1, &small}, {0, &large}});
+
+    for (size_t i = 0; i < 100; ++i) {
+        ASSERT_LT(gen.generate(), 10);
+    }
+}
+
+TEST(QuickCheckOOTest, FrequencyGenZeroWeights) {
+    IntGen small(0, 9);
+    ASSERT_THROW(FrequencyGen<int>({{0, &small}}), std::invalid_argument);
+}
+
+
+// Property function for allocation tracking
+bool reverseAllocatesOnce(std::string str) {
+    AllocStats stats = measureAllocations([&]() {
+        std::string reversed = reverseWithSwap(str);
+    });
+    return stats.allocations <= 1 && stats.peakBytes <= 2 * (str.size() + 1);
+}
+
+// Test case for allocation tracking
+TEST(QuickCheckOOTest, AllocationTest) {
+    StringGen stringGen;
+    CheckConfig config;
+    config.trackAllocations = true;
+    bool passed = quickCheckOO(&stringGen, reverseAllocatesOnce, config);
+    ASSERT_TRUE(passed);
+}
+
+
+// Test case for callables taking const T&, no copy of the generated value
+TEST(QuickCheckOOTest, LambdaTest) {
+    VectorStringGen listGen;
+    CheckConfig config;
+    config.trackAllocations = true;
+
+    bool passed = quickCheckOO(&listGen, [](const std::vector<std::string>& list) {
+        return currentAllocStats().allocations == 0 && list.size() <= 10;
+    }, config);
+    ASSERT_TRUE(passed);
+}
+
+// Captureless lambdas taking T by value use the generic overload
+TEST(QuickCheckOOTest, CapturelessLambdaTest) {
+    IntGen intGen;
+    bool passed = quickCheckOO(&intGen, [](int n) { return n >= 0; });
+    ASSERT_TRUE(passed);
+
+    CheckConfig config(50);
+    passed = quickCheckOO(&intGen, [](int n) { return n <= 100; }, config);
+    ASSERT_TRUE(passed);
+}
+
+// Test case for multiple generated arguments
+TEST(QuickCheckOOTest, TupleGenTest) {
+    IntGen intGen(-10, 20);
+    StringGen stringGen;
+    TupleGen<int, std::string> tupleGen(&intGen, &stringGen);
+
+    bool passed = quickCheckOO(&tupleGen, [](int n, const std::string& str) {
+        return multiplyWithOperator(n, static_cast<int>(str.size())) ==
+               multiplyWithLoop(n, static_cast<int>(str.size()));
+    });
+    ASSERT_TRUE(passed);
+}
+
+
+// Test case for tree generator of Persons
+TEST(QuickCheckOOTest, TreeGenTest) {
+    PersonGen personGen;
+    TreeGen<Person> treeGen(&personGen, 10, 3);
+
+    bool passed = quickCheckOO(&treeGen, [](const Tree<Person>& t) {
+        return t.size() <= 10 && t.root->value.validateAge();
+    });
+    ASSERT_TRUE(passed);
+}
+
+
+// Mutation mode is reproducible when replayed from the first case
+TEST(QuickCheckOOTest, MutationReplayTest) {
+    VectorStringGen listGen;
+    CheckConfig config(200);
+    config.mutationRatio = 0.5;
+
+    std::vector<std::vector<std::string>> first;
+    std::vector<std::vector<std::string>> second;
+    quickCheckOO(&listGen, [&first](const std::vector<std::string>& list) {
+        first.push_back(list);
+        return true;
+    }, config);
+    quickCheckOO(&listGen, [&second](const std::vector<std::string>& list) {
+        second.push_back(list);
+        return true;
+    }, config);
+
+    ASSERT_EQ(first, second);
+}
+
+// Mutated cases respect the bounds of their generator
+TEST(QuickCheckOOTest, MutationStaysInDomain) {
+    CheckConfig config(500);
+    config.mutationRatio = 0.8;
+
+    VectorStringGen listGen;
+    ASSERT_TRUE(quickCheckOO(&listGen, [](const std::vector<std::string>& list) {
+        return list.size() <= 10;
+    }, config));
+
+    PersonGen personGen;
+    ASSERT_TRUE(quickCheckOO(&personGen, checkingPersonAge, config));
+
+    StringGen stringGen(3, 4, 'a', 'h');
+    ASSERT_TRUE(quickCheckOO(&stringGen, [](const std::string& str) {
+        return str.size() >= 3 && str.size() <= 4 && str.find_first_not_of("abcdefgh ") == std::string::npos;
+    }, config));
+
+    IntGen intGen(-10, 20);
+    ASSERT_TRUE(quickCheckOO(&intGen, [](int n) { return n >= -10 && n <= 20; }, config));
+    ASSERT_TRUE(quickCheckOO(&intGen, checkMultiplication, config));
+}
@@ -3,22 +3,43 @@
 #include "reverseMethods.h"
 #include "multiplicationMethods.h"
 
+#include <sstream>
+#include <thread>
 
-// Property function for integer generator
+
+// Property function for integer generator, squares that overflow int are skipped
 bool checkingMultiplication(int n) {
-    return multiplyWithOperator(n, n) == multiplyWithLoop(n, n);
+    return squaresMatch(n);
 }
 bool checkingMultiplication(unsigned int n) {
-    return multiplyWithOperator(n, n) == multiplyWithLoop(n, n);
+    if (n > static_cast<unsigned int>(std::numeric_limits<int>::max())) {
+        return true;
+    }
+    return checkingMultiplication(static_cast<int>(n));
 }
 
 // Test case for integer generator
 TEST(QuickCheckTest, IntGenTest) {
-    quickCheck<int>(checkingMultiplication);
+    bool passed = quickCheck<int>(checkingMultiplication);
+    ASSERT_TRUE(passed);
 }
 
 TEST(QuickCheckTest, UnsignedIntGenTest) {
-    quickCheck<unsigned int>(checkingMultiplication);
+    bool passed = quickCheck<unsigned int>(checkingMultiplication);
+    ASSERT_TRUE(passed);
+}
+
+// The INT_MIN/INT_MAX edge cases expose the overflow instead of hiding it
+TEST(QuickCheckTest, MultiplicationOverflowTest) {
+    CheckConfig config(100);
+    config.edgeCaseRatio = 0.5;
+    config.shrink = false;
+
+    bool passed = quickCheck<int>([](int n) {
+        long long square = static_cast<long long>(n) * n;
+        return square <= std::numeric_limits<int>::max();
+    }, config);
+    ASSERT_FALSE(passed);
 }
 
 
@@ -30,7 +51,8 @@ bool comparingReverseMethods(std::string str) {
 
 // Test case for string generator
 TEST(QuickCheckTest, StringGenTest) {
-    quickCheck<std::string>(comparingReverseMethods);
+    bool passed = quickCheck<std::string>(comparingReverseMethods);
+    ASSERT_TRUE(passed);
 }
 
 
@@ -42,7 +64,8 @@ bool checkingBooleanValue(bool value) {
 
 // Test case for boolean generator
 TEST(QuickCheckTest, BoolTest) {
-    quickCheck<bool>(checkingBooleanValue);
+    bool passed = quickCheck<bool>(checkingBooleanValue);
+    ASSERT_TRUE(passed);
 }
 
 // Test case for vector generator
@@ -78,5 +101,444 @@ bool checkPersonAge(Person person) {
 
 // Test case for Person generator
 TEST(QuickCheckTest, PersonTest) {
-    quickCheck<Person>(checkPersonAge);
-}
\ No newline at end of file
+    bool passed = quickCheck<Person>(checkPersonAge);
+    ASSERT_TRUE(passed);
+}
+
+
+// Case k is computed directly from (seed, property id, k)
+TEST(QuickCheckTest, CounterBasedReproduction) {
+    Gen<std::string> g = arbitrary<std::string>();
+    CheckConfig config(1000);
+
+    std::vector<std::string> values;
+    for (uint64_t i = 0; i < config.numCases; ++i) {
+        config.beginCase(i);
+        values.push_back(g.generate());
+    }
+
+    // jump straight to single cases, in any order
+    for (uint64_t i : {873, 0, 999, 42}) {
+        CheckConfig single = CheckConfig::reproduce({config.seed, config.propertyId, i});
+        single.beginCase(single.firstCase);
+        ASSERT_EQ(values[i], g.generate());
+    }
+}
+
+// The id carries the edge case ratio, cases of a run with a non-default ratio reproduce too
+TEST(QuickCheckTest, ReproductionWithEdgeCaseRatio) {
+    Gen<int> g = arbitrary<int>();
+    CheckConfig config(100);
+    config.edgeCaseRatio = 0.9;
+
+    std::vector<int> values;
+    ASSERT_TRUE(quickCheck(g, [&values](int n) {
+        values.push_back(n);
+        return true;
+    }, config));
+
+    for (uint64_t i = 0; i < config.numCases; ++i) {
+        CaseId id = config.beginCase(i);
+        CheckConfig single = CheckConfig::reproduce(id);
+        single.beginCase(single.firstCase);
+        ASSERT_EQ(values[i], g.generate());
+    }
+
+    std::ostringstream printed;
+    printed << config.beginCase(3);
+    ASSERT_EQ(printed.str(), "seed=" + std::to_string(config.seed) + " property=0 case=3 edgeCaseRatio=0.9");
+}
+
+TEST(QuickCheckTest, PropertyIdSelectsStream) {
+    Philox a(7, propertyId("reverse"), 3);
+    Philox b(7, propertyId("multiply"), 3);
+    Philox c(7, propertyId("reverse"), 3);
+
+    bool differs = false;
+    for (int i = 0; i < 8; ++i) {
+        auto va = a();
+        differs = differs || va != b();
+        ASSERT_EQ(va, c());
+    }
+    ASSERT_TRUE(differs);
+}
+
+
+// Edge cases are hit within a few cases
+TEST(QuickCheckTest, IntEdgeCases) {
+    Gen<int> g = arbitrary<int>();
+    EdgeCaseRatioScope edgeCases(0.5);
+
+    bool hitMin = false;
+    bool hitMax = false;
+    for (size_t i = 0; i < 100; ++i) {
+        int value = g.generate();
+        hitMin = hitMin || value == std::numeric_limits<int>::min();
+        hitMax = hitMax || value == std::numeric_limits<int>::max();
+    }
+
+    ASSERT_TRUE(hitMin);
+    ASSERT_TRUE(hitMax);
+}
+
+TEST(QuickCheckTest, StringEdgeCases) {
+    Gen<std::string> g = arbitrary<std::string>();
+    EdgeCaseRatioScope edgeCases(1.0);
+
+    bool hitEmpty = false;
+    bool hitSpaces = false;
+    for (size_t i = 0; i < 100; ++i) {
+        std::string value = g.generate();
+        hitEmpty = hitEmpty || value.empty();
+        hitSpaces = hitSpaces || (!value.empty() && value.find_first_not_of(' ') == std::string::npos);
+    }
+
+    ASSERT_TRUE(hitEmpty);
+    ASSERT_TRUE(hitSpaces);
+}
+
+// Weighted generation never picks a zero weight
+TEST(QuickCheckTest, FrequencyTest) {
+    Gen<int> g = frequency<int>({{0, elements<int>({1})}, {3, elements<int>({2, 3})}});
+
+    for (size_t i = 0; i < 100; ++i) {
+        int value = g.generate();
+        ASSERT_TRUE(value == 2 || value == 3);
+    }
+}
+
+// Generators with nothing to pick from fail when built
+TEST(QuickCheckTest, EmptyChoicesThrow) {
+    ASSERT_THROW(elements<int>({}), std::invalid_argument);
+    ASSERT_THROW(frequency<int>({{0, elements<int>({1})}, {0, elements<int>({2})}}), std::invalid_argument);
+}
+
+
+// Scopes nest and only count the calling thread
+TEST(QuickCheckTest, AllocScopeTest) {
+    AllocScope outer;
+    std::vector<int>* list = new std::vector<int>(100);
+
+    AllocStats inner = measureAllocations([]() {
+        std::string str(100, 'a');
+    });
+    ASSERT_EQ(inner.allocations, 1u);
+    ASSERT_EQ(inner.deallocations, 1u);
+    ASSERT_GE(inner.peakBytes, 100u);
+
+    delete list;
+    ASSERT_EQ(outer.stats().allocations, 3u);
+    ASSERT_EQ(outer.stats().deallocations, 3u);
+
+    // allocations of another thread are not counted while the scope is active
+    std::thread other([]() {
+        for (size_t i = 0; i < 100; ++i) {
+            delete new std::vector<int>(100);
+        }
+    });
+    AllocStats started = outer.stats(); // std::thread itself allocates on this thread
+    other.join();
+    ASSERT_EQ(outer.stats().allocations, started.allocations);
+    ASSERT_EQ(outer.stats().bytes, started.bytes);
+
+    outer.stop();
+    ASSERT_EQ(currentAllocStats().allocations, 0u);
+}
+
+// Built-in generators only allocate the values themselves, not generators per element
+TEST(QuickCheckTest, GenerationAllocations) {
+    Gen<std::string> strings = arbitrary<std::string>();
+    Gen<std::vector<std::string>> lists = arbitrary<std::vector<std::string>>();
+    Gen<Person> persons = arbitrary<Person>();
+    CheckConfig config(100);
+
+    for (uint64_t i = 0; i < config.numCases; ++i) {
+        config.beginCase(i);
+        std::string str;
+        ASSERT_LE(measureAllocations([&]() { str = strings.generate(); }).allocations, 1u);
+
+        std::vector<std::string> list;
+        size_t listAllocations = measureAllocations([&]() { list = lists.generate(); }).allocations;
+        ASSERT_LE(listAllocations, list.size() + 1);
+
+        Person person;
+        ASSERT_LE(measureAllocations([&]() { person = persons.generate(); }).allocations, 2u);
+    }
+}
+
+// Stopping an outer scope first unlinks it, the inner one keeps counting
+TEST(QuickCheckTest, AllocScopeStopOrder) {
+    AllocScope outer;
+    AllocScope inner;
+    outer.stop();
+
+    std::string* str = new std::string(100, 'a');
+    delete str;
+    ASSERT_EQ(outer.stats().allocations, 0u);
+    ASSERT_EQ(inner.stats().allocations, 2u);
+
+    inner.stop();
+    ASSERT_EQ(currentAllocStats().allocations, 0u);
+}
+
+
+// Test case for callables taking const T&, with captured state
+TEST(QuickCheckTest, LambdaTest) {
+    size_t calls = 0;
+    bool passed = quickCheck<std::vector<std::string>>([&calls](const std::vector<std::string>& list) {
+        ++calls;
+        return list.size() <= 10;
+    });
+
+    ASSERT_TRUE(passed);
+    ASSERT_EQ(calls, 20u);
+}
+
+TEST(QuickCheckTest, CapturelessLambdaTest) {
+    bool passed = quickCheck<bool>([](bool value) { return value || !value; });
+    ASSERT_TRUE(passed);
+
+    passed = quickCheck<std::string>([](std::string str) { return str.size() <= 40; }, CheckConfig(50));
+    ASSERT_TRUE(passed);
+}
+
+// Test case for multiple generated arguments
+TEST(QuickCheckTest, MultipleArgumentsTest) {
+    bool passed = quickCheck<std::string, std::string>([](const std::string& a, const std::string& b) {
+        return reverseWithSwap(a + b) == reverseWithSwap(b) + reverseWithSwap(a);
+    }, CheckConfig(50));
+
+    ASSERT_TRUE(passed);
+}
+
+
+// Test case for recursive generators, the size budget is shared by all branches
+TEST(QuickCheckTest, RecursiveTest) {
+    Gen<std::string> expr = recursive<std::string>(elements<std::string>({"x", "y", "1"}), [](Gen<std::string>& sub) {
+        std::string lhs = sub.generate();
+        std::string rhs = sub.generate();
+        return "(" + lhs + " + " + rhs + ")";
+    }, 10);
+
+    CheckConfig config(100);
+    bool passed = quickCheck(expr, [](const std::string& e) {
+        return std::count(e.begin(), e.end(), '+') <= 10;
+    }, config);
+    ASSERT_TRUE(passed);
+
+    // failures are reported and shrunk by the runner
+    std::string lastFailure;
+    passed = quickCheck(expr, [&lastFailure](const std::string& e) {
+        bool few = std::count(e.begin(), e.end(), '+') < 3;
+        if (!few) {
+            lastFailure = e;
+        }
+        return few;
+    }, config);
+    ASSERT_FALSE(passed);
+    ASSERT_EQ(std::count(lastFailure.begin(), lastFailure.end(), '+'), 3);
+}
+
+// Failing recursive values shrink by replacing branches with their leaves or subvalues
+TEST(QuickCheckTest, RecursiveShrinkTest) {
+    Gen<std::string> expr = recursive<std::string>(elements<std::string>({"x", "y", "1"}), [](Gen<std::string>& sub) {
+        std::string lhs = sub.generate();
+        std::string op = elements<std::string>({" + ", " * "}).generate();
+        std::string rhs = sub.generate();
+        return "(" + lhs + op + rhs + ")";
+    }, 20);
+    auto fewOperators = [](const std::string& e) {
+        return std::count(e.begin(), e.end(), '(') < 3;
+    };
+
+    std::string failing;
+    for (uint64_t i = 0; failing.empty(); ++i) {
+        CheckConfig::reproduce({1, 0, i}).beginCase(i);
+        std::string e = expr.generate();
+        if (!fewOperators(e) && std::count(e.begin(), e.end(), '(') > 5) {
+            failing = e;
+        }
+    }
+
+    CheckConfig config;
+    size_t steps = shrinkFailure(config, expr.shrink, fewOperators, failing);
+    ASSERT_GT(steps, 0u);
+    ASSERT_EQ(std::count(failing.begin(), failing.end(), '('), 3);
+}
+
+// Values built concurrently keep separate budgets
+TEST(QuickCheckTest, RecursiveThreadsTest) {
+    Gen<std::string> expr = recursive<std::string>(elements<std::string>({"x"}), [](Gen<std::string>& sub) {
+        return "(" + sub.generate() + " + " + sub.generate() + ")";
+    }, 5);
+
+    auto generateMany = [expr]() mutable {
+        for (uint64_t i = 0; i < 200; ++i) {
+            ArenaScope arena;
+            seedCase(2, 0, i);
+            std::string e = expr.generate();
+            ASSERT_LE(std::count(e.begin(), e.end(), '+'), 5);
+        }
+    };
+    std::thread a(generateMany);
+    std::thread b(generateMany);
+    a.join();
+    b.join();
+}
+
+// Outside a runner an ArenaScope releases the nodes and derivations of each value
+TEST(QuickCheckTest, ArenaScopeTest) {
+    Gen<Tree<int>> trees = tree(arbitrary<int>(), 15);
+    Gen<std::string> expr = recursive<std::string>(elements<std::string>({"x"}), [](Gen<std::string>& sub) {
+        return "(" + sub.generate() + " + " + sub.generate() + ")";
+    }, 10);
+
+    caseArena().reset(); // values of earlier tests
+    seedCase(3, 0, 0);
+    for (size_t i = 0; i < 1000; ++i) {
+        ArenaScope arena;
+        ASSERT_GE(trees.generate().size(), 1u);
+        expr.generate();
+        ASSERT_LE(caseDerivations<std::string>().size(), 1u);
+    }
+    ASSERT_EQ(caseArena().bytesUsed(), 0u);
+    ASSERT_TRUE(caseDerivations<std::string>().empty());
+}
+
+// Test case for tree generator
+TEST(QuickCheckTest, TreeTest) {
+    Gen<Tree<int>> g = tree(arbitrary<int>(), 15);
+    CheckConfig config(100);
+
+    bool passed = quickCheck(g, [](const Tree<int>& t) {
+        return t.size() >= 1 && t.size() <= 15;
+    }, config);
+    ASSERT_TRUE(passed);
+}
+
+// Failing trees shrink to a minimal subtree
+TEST(QuickCheckTest, TreeShrinkTest) {
+    Gen<Tree<unsigned int>> g = tree(arbitrary<unsigned int>(), 30);
+    auto noLargeNodes = [](const Tree<unsigned int>& t) {
+        return t.depth() < 3;
+    };
+
+    Tree<unsigned int> failing;
+    for (uint64_t i = 0; !failing.root; ++i) {
+        CheckConfig::reproduce({1, 0, i}).beginCase(i);
+        Tree<unsigned int> t = g.generate();
+        if (!noLargeNodes(t)) {
+            failing = t;
+        }
+    }
+
+    CheckConfig config;
+    size_t steps = shrinkFailure(config, g.shrink, noLargeNodes, failing);
+    ASSERT_GT(steps, 0u);
+    ASSERT_EQ(failing.size(), 3u);
+    ASSERT_EQ(failing.depth(), 3u);
+}
+
+
+// Test case for mutation mode, mutated strings stay in the generator's domain
+TEST(QuickCheckTest, MutationTest) {
+    CheckConfig config(500);
+    config.mutationRatio = 0.8;
+
+    Gen<std::string> g = arbitrary<std::string>();
+    size_t mutated = 0;
+    std::function<void(std::string&)> mutate = g.mutate;
+    g.mutate = [&mutated, mutate](std::string& str) {
+        ++mutated;
+        mutate(str);
+    };
+
+    bool passed = quickCheck(g, [](const std::string& str) {
+        return str.size() <= 40 && str.find_first_not_of("abcdefghijklmnopqrstuvwxyz ") == std::string::npos;
+    }, config);
+
+    ASSERT_TRUE(passed);
+    ASSERT_GT(mutated, 300u);
+}
+
+// Fresh cases in mutation mode get the same values as when run alone
+TEST(QuickCheckTest, MutationKeepsFreshCases) {
+    Gen<int> g = arbitrary<int>();
+    CheckConfig config(200);
+    config.mutationRatio = 0.5;
+
+    std::vector<int> values;
+    quickCheck(g, [&values](int n) {
+        values.push_back(n);
+        return true;
+    }, config);
+
+    size_t fresh = 0;
+    for (uint64_t i = 0; i < config.numCases; ++i) {
+        CheckConfig single = CheckConfig::reproduce({config.seed, config.propertyId, i});
+        single.beginCase(i);
+        if (g.generate() == values[i]) {
+            ++fresh;
+        }
+    }
+    ASSERT_GE(fresh, 80u);
+    ASSERT_LT(fresh, config.numCases);
+}
+
+// Generators without a mutate hook always draw fresh values
+TEST(QuickCheckTest, MutationWithoutHook) {
+    Gen<int> g = elements<int>({1, 2, 3});
+    CheckConfig config(100);
+    config.mutationRatio = 1.0;
+
+    bool passed = quickCheck(g, [](int n) { return n >= 1 && n <= 3; }, config);
+    ASSERT_TRUE(passed);
+}
+
+TEST(QuickCheckTest, MutatePersonTest) {
+    Gen<Person> g = arbitrary<Person>();
+    Person person;
+    person.firstName = "jane";
+    person.lastName = "doe";
+    person.age = 100;
+    person.role = STUDENT;
+
+    seedCase(1, 0, 0);
+    size_t changed = 0;
+    for (int i = 0; i < 500; ++i) {
+        Person before = person;
+        g.mutate(person);
+        if (before.firstName != person.firstName || before.lastName != person.lastName ||
+            before.age != person.age || before.role != person.role) {
+            ++changed;
+        }
+        ASSERT_TRUE(person.age >= 0 && person.age <= 100);
+        ASSERT_LE(person.firstName.size(), 40u);
+        ASSERT_LE(person.lastName.size(), 40u);
+    }
+    ASSERT_GE(changed, 400u);
+}
+
+// Mutations reuse the value's allocations, only new vector elements allocate
+TEST(QuickCheckTest, MutationAllocations) {
+    Gen<std::string> strings = arbitrary<std::string>();
+    Gen<std::vector<std::string>> lists = arbitrary<std::vector<std::string>>();
+    Gen<Person> persons = arbitrary<Person>();
+
+    seedCase(1, 0, 0);
+    std::string str = strings.generate();
+    std::vector<std::string> list = lists.generate();
+    Person person = persons.generate();
+
+    size_t stringAllocations = 0;
+    size_t listAllocations = 0;
+    size_t personAllocations = 0;
+    for (size_t i = 0; i < 1000; ++i) {
+        stringAllocations += measureAllocations([&]() { strings.mutate(str); }).allocations;
+        listAllocations += measureAllocations([&]() { lists.mutate(list); }).allocations;
+        personAllocations += measureAllocations([&]() { persons.mutate(person); }).allocations;
+    }
+    ASSERT_LE(stringAllocations, 10u);
+    ASSERT_LE(personAllocations, 10u);
+    ASSERT_LE(listAllocations, 500u);
+}
@@ -0,0 +1,87 @@
+#include "Corpus/Minimize.h"
+#include "Person.h"
+#include "multiplicationMethods.h"
+#include "reverseMethods.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Corpus minimizer for saved property inputs (see CheckConfig::corpusFile)
+// usage: seminar_cmin <property> <input corpus> <output corpus> [threads]
+
+typedef std::function<CorpusStats(std::istream&, std::ostream&, size_t)> Minimizer;
+
+// Properties of the test suites, by name
+std::map<std::string, Minimizer> properties() {
+    std::map<std::string, Minimizer> result;
+
+    result["multiply"] = [](std::istream& in, std::ostream& out, size_t threads) {
+        return minimizeCorpus<int>(in, out, squaresMatch, threads);
+    };
+
+    result["reverse"] = [](std::istream& in, std::ostream& out, size_t threads) {
+        return minimizeCorpus<std::string>(in, out, [](const std::string& str) {
+            return reverseWithStdReverse(str) == reverseWithSwap(str);
+        }, threads);
+    };
+
+    result["reverse-list"] = [](std::istream& in, std::ostream& out, size_t threads) {
+        return minimizeCorpus<std::vector<std::string>>(in, out, [](const std::vector<std::string>& list) {
+            for (const std::string& str : list) {
+                if (reverseWithStdReverse(str) != reverseWithSwap(str)) {
+                    return false;
+                }
+            }
+            return list.size() <= 10;
+        }, threads);
+    };
+
+    result["person-age"] = [](std::istream& in, std::ostream& out, size_t threads) {
+        return minimizeCorpus<Person>(in, out, [](const Person& person) {
+            return person.validateAge();
+        }, threads);
+    };
+
+    return result;
+}
+
+int main(int argc, char* argv[]) {
+    std::map<std::string, Minimizer> minimizers = properties();
+
+    if (argc < 4 || argc > 5 || minimizers.find(argv[1]) == minimizers.end()) {
+        std::cerr << "usage: " << argv[0] << " <property> <input corpus> <output corpus> [threads]" << std::endl;
+        std::cerr << "properties:";
+        for (const auto& minimizer : minimizers) {
+            std::cerr << " " << minimizer.first;
+        }
+        std::cerr << std::endl;
+        return 2;
+    }
+
+    std::ifstream in(argv[2]);
+    if (!in) {
+        std::cerr << "cannot read " << argv[2] << std::endl;
+        return 1;
+    }
+    std::ofstream out(argv[3]);
+    if (!out) {
+        std::cerr << "cannot write " << argv[3] << std::endl;
+        return 1;
+    }
+
+    size_t threads = argc == 5 ? std::strtoul(argv[4], nullptr, 10) : std::thread::hardware_concurrency();
+    CorpusStats stats = minimizers[argv[1]](in, out, threads);
+
+    std::cout << "read: " << stats.read
+              << " malformed: " << stats.malformed
+              << " duplicates: " << stats.duplicates
+              << " redundant: " << stats.redundant
+              << " kept: " << stats.kept << std::endl;
+    return 0;
+}